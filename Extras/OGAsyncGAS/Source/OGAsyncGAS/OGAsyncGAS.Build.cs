@@ -0,0 +1,28 @@
+﻿using UnrealBuildTool;
+
+public class OGAsyncGAS : ModuleRules
+{
+	public OGAsyncGAS(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"GameplayAbilities",
+				"GameplayTags",
+				"OGAsync"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Engine",
+				"GameplayTasks"
+			}
+		);
+	}
+}
@@ -0,0 +1,370 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAbilityFutures.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+namespace
+{
+	/**
+	 * Lightweight replacement for the UAbilityTask object: owns the promise and knows how to unbind whatever the wait is
+	 * listening to. Delegate lambdas hold a shared reference to it, so if the delegate is dropped without firing
+	 * (e.g. the world is torn down) the promise is destroyed and the future is rejected.
+	 */
+	template<typename T>
+	struct TOGAbilityWaitState : TSharedFromThis<TOGAbilityWaitState<T>>
+	{
+		TOGPromise<T> Promise;
+
+		//Removes the binding this wait is listening to
+		TFunction<void()> Unbind;
+
+		//Called before rejecting when the owning ability ends
+		TFunction<void()> OnAbilityEnded;
+
+		TWeakObjectPtr<UGameplayAbility> Ability;
+		FDelegateHandle AbilityEndedHandle;
+
+		void EndWithAbility(UGameplayAbility* InAbility)
+		{
+			if (!InAbility)
+				return;
+
+			Ability = InAbility;
+			const TWeakPtr<TOGAbilityWaitState> WeakThis = this->AsShared();
+			AbilityEndedHandle = InAbility->OnGameplayAbilityEnded.AddLambda([WeakThis](UGameplayAbility*)
+			{
+				if (const TSharedPtr<TOGAbilityWaitState> Pinned = WeakThis.Pin())
+				{
+					if (Pinned->OnAbilityEnded)
+					{
+						Pinned->OnAbilityEnded();
+					}
+					Pinned->Reject(TEXT("Ability ended before the wait completed"));
+				}
+			});
+		}
+
+		void Release()
+		{
+			if (Unbind)
+			{
+				const TFunction<void()> LocalUnbind = MoveTemp(Unbind);
+				Unbind = nullptr;
+				LocalUnbind();
+			}
+			if (UGameplayAbility* OwningAbility = Ability.Get())
+			{
+				OwningAbility->OnGameplayAbilityEnded.Remove(AbilityEndedHandle);
+			}
+			Ability.Reset();
+			OnAbilityEnded = nullptr;
+		}
+
+		template<typename... ArgTypes>
+		void Resolve(ArgTypes&&... Args)
+		{
+			Release();
+			if (Promise->IsPending())
+			{
+				Promise->Fulfill(Forward<ArgTypes>(Args)...);
+			}
+		}
+
+		void Reject(const FString& Reason)
+		{
+			Release();
+			if (Promise->IsPending())
+			{
+				Promise->Throw(Reason);
+			}
+		}
+	};
+
+	template<typename T>
+	TOGFuture<T> MakeRejectedFuture(const FString& Reason)
+	{
+		TSharedRef<TOGFutureState<T>> RejectedState = OGAsync::MakeFutureState<T>();
+		RejectedState->Throw(Reason);
+		return TOGFuture<T>(RejectedState);
+	}
+
+	TOGFuture<FGameplayEventData> WaitGameplayEventInternal(UAbilitySystemComponent* AbilitySystem, FGameplayTag EventTag, bool bOnlyMatchExact, UGameplayAbility* Ability)
+	{
+		if (!AbilitySystem || !EventTag.IsValid())
+			return MakeRejectedFuture<FGameplayEventData>(TEXT("WaitGameplayEvent requires a valid ability system component and event tag"));
+
+		const TSharedRef<TOGAbilityWaitState<FGameplayEventData>> WaitState = MakeShared<TOGAbilityWaitState<FGameplayEventData>>();
+		TOGFuture<FGameplayEventData> Future = WaitState->Promise;
+		const TWeakObjectPtr<UAbilitySystemComponent> WeakAbilitySystem = AbilitySystem;
+
+		//Removing the binding destroys this lambda's captures, so always work from a local copy of the state
+		auto OnEvent = [WaitState](const FGameplayEventData* Payload)
+		{
+			const TSharedRef<TOGAbilityWaitState<FGameplayEventData>> LocalState = WaitState;
+			LocalState->Resolve(Payload ? *Payload : FGameplayEventData());
+		};
+
+		if (bOnlyMatchExact)
+		{
+			const FDelegateHandle Handle = AbilitySystem->GenericGameplayEventCallbacks.FindOrAdd(EventTag).AddLambda(OnEvent);
+			WaitState->Unbind = [WeakAbilitySystem, EventTag, Handle]()
+			{
+				if (UAbilitySystemComponent* Component = WeakAbilitySystem.Get())
+				{
+					if (FGameplayEventMulticastDelegate* Delegate = Component->GenericGameplayEventCallbacks.Find(EventTag))
+					{
+						Delegate->Remove(Handle);
+					}
+				}
+			};
+		}
+		else
+		{
+			const FGameplayTagContainer TagFilter(EventTag);
+			const FDelegateHandle Handle = AbilitySystem->AddGameplayEventTagContainerDelegate(TagFilter,
+				FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([OnEvent](FGameplayTag, const FGameplayEventData* Payload)
+				{
+					OnEvent(Payload);
+				}));
+			WaitState->Unbind = [WeakAbilitySystem, TagFilter, Handle]()
+			{
+				if (UAbilitySystemComponent* Component = WeakAbilitySystem.Get())
+				{
+					Component->RemoveGameplayEventTagContainerDelegate(TagFilter, Handle);
+				}
+			};
+		}
+
+		WaitState->EndWithAbility(Ability);
+		return Future;
+	}
+
+	TOGFuture<void> WaitDelayInternal(UWorld* World, float Seconds, UGameplayAbility* Ability)
+	{
+		if (!World)
+			return MakeRejectedFuture<void>(TEXT("WaitDelay requires a valid world"));
+
+		const TSharedRef<TOGAbilityWaitState<void>> WaitState = MakeShared<TOGAbilityWaitState<void>>();
+		TOGFuture<void> Future = WaitState->Promise;
+
+		const FTimerDelegate OnTimer = FTimerDelegate::CreateLambda([WaitState]()
+		{
+			const TSharedRef<TOGAbilityWaitState<void>> LocalState = WaitState;
+			LocalState->Resolve();
+		});
+
+		FTimerManager& TimerManager = World->GetTimerManager();
+		FTimerHandle TimerHandle;
+		if (Seconds > 0.f)
+		{
+			TimerManager.SetTimer(TimerHandle, OnTimer, Seconds, false);
+		}
+		else
+		{
+			TimerHandle = TimerManager.SetTimerForNextTick(OnTimer);
+		}
+
+		const TWeakObjectPtr<UWorld> WeakWorld = World;
+		WaitState->Unbind = [WeakWorld, TimerHandle]() mutable
+		{
+			if (UWorld* TimerWorld = WeakWorld.Get())
+			{
+				TimerWorld->GetTimerManager().ClearTimer(TimerHandle);
+			}
+		};
+
+		WaitState->EndWithAbility(Ability);
+		return Future;
+	}
+
+	TOGFuture<FGameplayAbilityTargetDataHandle> MakeTargetDataState(UGameplayAbility* Ability, const TFunctionRef<void(const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>>&)>& Bind)
+	{
+		const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>> WaitState = MakeShared<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>>();
+		TOGFuture<FGameplayAbilityTargetDataHandle> Future = WaitState->Promise;
+		Bind(WaitState);
+		//Binding may have already resolved the wait, in which case there is nothing to end with the ability
+		if (WaitState->Promise->IsPending())
+		{
+			WaitState->EndWithAbility(Ability);
+		}
+		return Future;
+	}
+}
+
+TOGFuture<FGameplayEventData> OGAsync::WaitGameplayEvent(UAbilitySystemComponent* AbilitySystem, FGameplayTag EventTag, bool bOnlyMatchExact)
+{
+	return WaitGameplayEventInternal(AbilitySystem, EventTag, bOnlyMatchExact, nullptr);
+}
+
+TOGFuture<FGameplayEventData> OGAsync::WaitGameplayEvent(UGameplayAbility* Ability, FGameplayTag EventTag, bool bOnlyMatchExact)
+{
+	if (!Ability)
+		return MakeRejectedFuture<FGameplayEventData>(TEXT("WaitGameplayEvent requires a valid ability"));
+	return WaitGameplayEventInternal(Ability->GetAbilitySystemComponentFromActorInfo(), EventTag, bOnlyMatchExact, Ability);
+}
+
+TOGFuture<void> OGAsync::WaitDelay(const UObject* WorldContext, float Seconds)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+	return WaitDelayInternal(World, Seconds, nullptr);
+}
+
+TOGFuture<void> OGAsync::WaitDelay(UGameplayAbility* Ability, float Seconds)
+{
+	if (!Ability)
+		return MakeRejectedFuture<void>(TEXT("WaitDelay requires a valid ability"));
+	return WaitDelayInternal(Ability->GetWorld(), Seconds, Ability);
+}
+
+TOGFuture<FGameplayAbilityTargetDataHandle> OGAsync::WaitTargetData(UGameplayAbility* Ability, AGameplayAbilityTargetActor* TargetActor,
+	EGameplayTargetingConfirmation::Type ConfirmationType)
+{
+	if (!Ability || !TargetActor)
+		return MakeRejectedFuture<FGameplayAbilityTargetDataHandle>(TEXT("WaitTargetData requires a valid ability and target actor"));
+
+	return MakeTargetDataState(Ability, [TargetActor, Ability, ConfirmationType](const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>>& WaitState)
+	{
+		const FDelegateHandle ReadyHandle = TargetActor->TargetDataReadyDelegate.AddLambda([WaitState](const FGameplayAbilityTargetDataHandle& Data)
+		{
+			const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>> LocalState = WaitState;
+			LocalState->Resolve(Data);
+		});
+		const FDelegateHandle CancelledHandle = TargetActor->CanceledDelegate.AddLambda([WaitState](const FGameplayAbilityTargetDataHandle&)
+		{
+			const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>> LocalState = WaitState;
+			LocalState->Reject(TEXT("Targeting was cancelled"));
+		});
+
+		const TWeakObjectPtr<AGameplayAbilityTargetActor> WeakTargetActor = TargetActor;
+		WaitState->Unbind = [WeakTargetActor, ReadyHandle, CancelledHandle]()
+		{
+			if (AGameplayAbilityTargetActor* Actor = WeakTargetActor.Get())
+			{
+				Actor->TargetDataReadyDelegate.Remove(ReadyHandle);
+				Actor->CanceledDelegate.Remove(CancelledHandle);
+			}
+		};
+
+		TargetActor->StartTargeting(Ability);
+		switch (ConfirmationType)
+		{
+		case EGameplayTargetingConfirmation::Instant:
+			TargetActor->ConfirmTargeting();
+			break;
+		case EGameplayTargetingConfirmation::UserConfirmed:
+			TargetActor->BindToConfirmCancelInputs();
+			break;
+		default:
+			//Custom confirmation is driven by the caller
+			break;
+		}
+	});
+}
+
+TOGFuture<FGameplayAbilityTargetDataHandle> OGAsync::WaitReplicatedTargetData(UGameplayAbility* Ability)
+{
+	UAbilitySystemComponent* AbilitySystem = Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr;
+	if (!AbilitySystem)
+		return MakeRejectedFuture<FGameplayAbilityTargetDataHandle>(TEXT("WaitReplicatedTargetData requires an ability with a valid ability system component"));
+
+	const FGameplayAbilitySpecHandle SpecHandle = Ability->GetCurrentAbilitySpecHandle();
+	const FPredictionKey PredictionKey = Ability->GetCurrentActivationInfo().GetActivationPredictionKey();
+
+	return MakeTargetDataState(Ability, [AbilitySystem, SpecHandle, PredictionKey](const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>>& WaitState)
+	{
+		const TWeakObjectPtr<UAbilitySystemComponent> WeakAbilitySystem = AbilitySystem;
+		const FDelegateHandle SetHandle = AbilitySystem->AbilityTargetDataSetDelegate(SpecHandle, PredictionKey).AddLambda(
+			[WaitState, WeakAbilitySystem, SpecHandle, PredictionKey](const FGameplayAbilityTargetDataHandle& Data, FGameplayTag)
+			{
+				const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>> LocalState = WaitState;
+				if (UAbilitySystemComponent* Component = WeakAbilitySystem.Get())
+				{
+					Component->ConsumeClientReplicatedTargetData(SpecHandle, PredictionKey);
+				}
+				LocalState->Resolve(Data);
+			});
+		const FDelegateHandle CancelledHandle = AbilitySystem->AbilityTargetDataCancelledDelegate(SpecHandle, PredictionKey).AddLambda([WaitState]()
+		{
+			const TSharedRef<TOGAbilityWaitState<FGameplayAbilityTargetDataHandle>> LocalState = WaitState;
+			LocalState->Reject(TEXT("Targeting was cancelled by the client"));
+		});
+
+		WaitState->Unbind = [WeakAbilitySystem, SpecHandle, PredictionKey, SetHandle, CancelledHandle]()
+		{
+			if (UAbilitySystemComponent* Component = WeakAbilitySystem.Get())
+			{
+				Component->AbilityTargetDataSetDelegate(SpecHandle, PredictionKey).Remove(SetHandle);
+				Component->AbilityTargetDataCancelledDelegate(SpecHandle, PredictionKey).Remove(CancelledHandle);
+			}
+		};
+
+		//The client data may have arrived before we started waiting
+		AbilitySystem->CallReplicatedTargetDataDelegatesIfSet(SpecHandle, PredictionKey);
+	});
+}
+
+TOGFuture<void> OGAsync::PlayMontageAndWait(UGameplayAbility* Ability, UAnimMontage* Montage, float Rate, FName StartSection, bool bStopWhenAbilityEnds)
+{
+	UAbilitySystemComponent* AbilitySystem = Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr;
+	const FGameplayAbilityActorInfo* ActorInfo = Ability ? Ability->GetCurrentActorInfo() : nullptr;
+	UAnimInstance* AnimInstance = ActorInfo ? ActorInfo->GetAnimInstance() : nullptr;
+	if (!AbilitySystem || !AnimInstance || !Montage)
+		return MakeRejectedFuture<void>(TEXT("PlayMontageAndWait requires an ability with a valid ability system component, anim instance and montage"));
+
+	if (AbilitySystem->PlayMontage(Ability, Ability->GetCurrentActivationInfo(), Montage, Rate, StartSection) <= 0.f)
+		return MakeRejectedFuture<void>(FString::Printf(TEXT("Montage %s failed to play"), *Montage->GetName()));
+
+	const TSharedRef<TOGAbilityWaitState<void>> WaitState = MakeShared<TOGAbilityWaitState<void>>();
+	TOGFuture<void> Future = WaitState->Promise;
+
+	FOnMontageEnded EndDelegate = FOnMontageEnded::CreateLambda([WaitState](UAnimMontage*, bool bInterrupted)
+	{
+		const TSharedRef<TOGAbilityWaitState<void>> LocalState = WaitState;
+		//The montage instance is done with this delegate, don't unbind it while it is executing
+		LocalState->Unbind = nullptr;
+		if (bInterrupted)
+		{
+			LocalState->Reject(TEXT("Montage was interrupted"));
+		}
+		else
+		{
+			LocalState->Resolve();
+		}
+	});
+	AnimInstance->Montage_SetEndDelegate(EndDelegate, Montage);
+
+	const TWeakObjectPtr<UAnimInstance> WeakAnimInstance = AnimInstance;
+	const TWeakObjectPtr<UAnimMontage> WeakMontage = Montage;
+	WaitState->Unbind = [WeakAnimInstance, WeakMontage]()
+	{
+		UAnimInstance* Anim = WeakAnimInstance.Get();
+		if (FAnimMontageInstance* MontageInstance = Anim ? Anim->GetActiveInstanceForMontage(WeakMontage.Get()) : nullptr)
+		{
+			MontageInstance->OnMontageEnded.Unbind();
+		}
+	};
+
+	if (bStopWhenAbilityEnds)
+	{
+		const TWeakObjectPtr<UAbilitySystemComponent> WeakAbilitySystem = AbilitySystem;
+		WaitState->OnAbilityEnded = [WeakAbilitySystem, WeakMontage]()
+		{
+			UAbilitySystemComponent* Component = WeakAbilitySystem.Get();
+			if (Component && WeakMontage.IsValid() && Component->GetCurrentMontage() == WeakMontage.Get())
+			{
+				Component->CurrentMontageStop();
+			}
+		};
+	}
+
+	WaitState->EndWithAbility(Ability);
+	return Future;
+}
@@ -0,0 +1,5 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncGASModule.h"
+	
+IMPLEMENT_MODULE(FOGAsyncGASModule, OGAsyncGAS)
@@ -0,0 +1,72 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "Abilities/GameplayAbilityTargetActor.h"
+#include "GameplayTagContainer.h"
+#include "OGFuture.h"
+
+class UAbilitySystemComponent;
+class UAnimMontage;
+class UGameplayAbility;
+
+/**
+ * Future returning equivalents of the common UAbilityTasks.
+ *
+ * Ability tasks are UObjects that have to be created, activated and garbage collected every time an ability waits on
+ * something. These functions bind directly to the underlying delegates instead and hand back a future, so the only
+ * allocation per wait is the future state itself.
+ *
+ * The overloads that take a UGameplayAbility behave like an ability task owned by that ability: if the ability ends
+ * before the wait completes, the future is rejected and any delegate bindings are removed. The ability must be
+ * instanced, as the end of the wait is tied to the instance.
+ *
+ * This module lives in the separate OGAsyncGAS plugin, which is off by default and enables GameplayAbilities when a
+ * project turns it on, so projects that use OGAsync without abilities don't pull GAS in.
+ *
+ * Usage:
+ *	void UMyAbility::ActivateAbility(...)
+ *	{
+ *		OGAsync::PlayMontageAndWait(this, AttackMontage)->WeakThen(this, [this]()
+ *		{
+ *			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+ *		});
+ *	}
+ */
+namespace OGAsync
+{
+	//Resolves with the next gameplay event matching EventTag that is sent to AbilitySystem.
+	OGASYNCGAS_API TOGFuture<FGameplayEventData> WaitGameplayEvent(UAbilitySystemComponent* AbilitySystem, FGameplayTag EventTag, bool bOnlyMatchExact = true);
+
+	//Resolves with the next gameplay event matching EventTag that is sent to the ability's owner, rejects if the ability ends first.
+	OGASYNCGAS_API TOGFuture<FGameplayEventData> WaitGameplayEvent(UGameplayAbility* Ability, FGameplayTag EventTag, bool bOnlyMatchExact = true);
+
+	//Resolves after Seconds of world time. Rejects if the world is torn down before then.
+	OGASYNCGAS_API TOGFuture<void> WaitDelay(const UObject* WorldContext, float Seconds);
+
+	//Resolves after Seconds of world time, rejects if the ability ends first.
+	OGASYNCGAS_API TOGFuture<void> WaitDelay(UGameplayAbility* Ability, float Seconds);
+
+	/**
+	 * Starts targeting with an already spawned target actor and resolves with the confirmed target data.
+	 * Rejects if targeting is cancelled or the ability ends first.
+	 * With Instant confirmation the data is produced immediately, with UserConfirmed the actor is bound to the
+	 * confirm/cancel inputs, and with Custom/CustomMulti it is up to the caller to confirm the target actor.
+	 * This only covers the locally controlled side, use WaitReplicatedTargetData on the server.
+	 */
+	OGASYNCGAS_API TOGFuture<FGameplayAbilityTargetDataHandle> WaitTargetData(UGameplayAbility* Ability, AGameplayAbilityTargetActor* TargetActor,
+		EGameplayTargetingConfirmation::Type ConfirmationType = EGameplayTargetingConfirmation::Instant);
+
+	//Server side counterpart of WaitTargetData, resolves with the target data the client sends for the current activation.
+	OGASYNCGAS_API TOGFuture<FGameplayAbilityTargetDataHandle> WaitReplicatedTargetData(UGameplayAbility* Ability);
+
+	/**
+	 * Plays a montage through the ability system and resolves when it finishes playing.
+	 * Rejects if the montage fails to play, is interrupted, or the ability ends first.
+	 * @param bStopWhenAbilityEnds Stop the montage if the ability ends before it finishes
+	 */
+	OGASYNCGAS_API TOGFuture<void> PlayMontageAndWait(UGameplayAbility* Ability, UAnimMontage* Montage, float Rate = 1.f,
+		FName StartSection = NAME_None, bool bStopWhenAbilityEnds = true);
+}
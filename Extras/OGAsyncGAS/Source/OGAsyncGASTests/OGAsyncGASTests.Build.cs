@@ -0,0 +1,28 @@
+﻿using UnrealBuildTool;
+
+public class OGAsyncGASTests : ModuleRules
+{
+	public OGAsyncGASTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"GameplayAbilities",
+				"GameplayTags",
+				"OGAsync",
+				"OGAsyncGAS"
+			}
+		);
+	}
+}
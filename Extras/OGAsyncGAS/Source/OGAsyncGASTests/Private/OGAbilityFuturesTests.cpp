@@ -0,0 +1,177 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+#include "OGAbilityFutures.h"
+#include "OGAsyncGASTestAbility.h"
+#include "Tests/AutomationCommon.h"
+
+namespace
+{
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_OGAsyncTest_Event, "OGAsync.Test.Event");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_OGAsyncTest_Event_Child, "OGAsync.Test.Event.Child");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_OGAsyncTest_Other, "OGAsync.Test.Other");
+
+    UAbilitySystemComponent* MakeAbilitySystem(AActor* Owner)
+    {
+        UAbilitySystemComponent* AbilitySystem = NewObject<UAbilitySystemComponent>(Owner);
+        AbilitySystem->RegisterComponent();
+        AbilitySystem->InitAbilityActorInfo(Owner, Owner);
+        return AbilitySystem;
+    }
+
+    // Grants and activates the test ability, returning the instance the waits can be tied to
+    UGameplayAbility* ActivateTestAbility(UAbilitySystemComponent* AbilitySystem, FGameplayAbilitySpecHandle& OutHandle)
+    {
+        OutHandle = AbilitySystem->GiveAbility(FGameplayAbilitySpec(UOGAsyncGASTestAbility::StaticClass()));
+        if (!AbilitySystem->TryActivateAbility(OutHandle))
+            return nullptr;
+
+        const FGameplayAbilitySpec* Spec = AbilitySystem->FindAbilitySpecFromHandle(OutHandle);
+        return Spec ? Spec->GetPrimaryInstance() : nullptr;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncGASGameplayEventTest, "OccamsGamekit.OGAsync.GAS.WaitGameplayEvent",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncGASGameplayEventTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* Owner = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{Owner->Destroy();};
+    UAbilitySystemComponent* AbilitySystem = MakeAbilitySystem(Owner);
+
+    // Test 1: Resolves with the payload of the first matching event and ignores other tags
+    {
+        TOGFuture<FGameplayEventData> Future = OGAsync::WaitGameplayEvent(AbilitySystem, TAG_OGAsyncTest_Event);
+
+        FGameplayEventData Other;
+        Other.EventMagnitude = 1.f;
+        AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Other, &Other);
+        TestTrue(TEXT("Other tags should not resolve the wait"), Future->IsPending());
+
+        FGameplayEventData Payload;
+        Payload.EventMagnitude = 3.f;
+        AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Event, &Payload);
+        FGameplayEventData Received;
+        TestTrue(TEXT("Matching event should resolve the wait"), Future->TryGetValue(Received));
+        TestEqual(TEXT("Payload should be passed through"), Received.EventMagnitude, 3.f);
+
+        // A second event must not reach the resolved wait, its binding is gone
+        AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Event, &Other);
+        TestTrue(TEXT("Binding should be removed once resolved"), !AbilitySystem->GenericGameplayEventCallbacks.Contains(TAG_OGAsyncTest_Event)
+            || !AbilitySystem->GenericGameplayEventCallbacks[TAG_OGAsyncTest_Event].IsBound());
+    }
+
+    // Test 2: Exact matching ignores child tags, inexact matching accepts them
+    {
+        TOGFuture<FGameplayEventData> Exact = OGAsync::WaitGameplayEvent(AbilitySystem, TAG_OGAsyncTest_Event, true);
+        TOGFuture<FGameplayEventData> Inexact = OGAsync::WaitGameplayEvent(AbilitySystem, TAG_OGAsyncTest_Event, false);
+
+        FGameplayEventData Payload;
+        AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Event_Child, &Payload);
+        TestTrue(TEXT("Exact wait should ignore child tags"), Exact->IsPending());
+        TestTrue(TEXT("Inexact wait should accept child tags"), Inexact->IsFulfilled());
+
+        AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Event, &Payload);
+        TestTrue(TEXT("Exact wait should accept its own tag"), Exact->IsFulfilled());
+    }
+
+    // Test 3: Invalid arguments reject immediately
+    {
+        TestTrue(TEXT("Null ability system should reject"), OGAsync::WaitGameplayEvent(static_cast<UAbilitySystemComponent*>(nullptr), TAG_OGAsyncTest_Event)->IsRejected());
+        TestTrue(TEXT("Invalid tag should reject"), OGAsync::WaitGameplayEvent(AbilitySystem, FGameplayTag())->IsRejected());
+        TestTrue(TEXT("Null ability should reject"), OGAsync::WaitGameplayEvent(static_cast<UGameplayAbility*>(nullptr), TAG_OGAsyncTest_Event)->IsRejected());
+    }
+
+    // Test 4: Waits tied to an ability reject when it ends and stop listening
+    {
+        FGameplayAbilitySpecHandle Handle;
+        UGameplayAbility* Ability = ActivateTestAbility(AbilitySystem, Handle);
+        if (TestNotNull(TEXT("Test ability should activate"), Ability))
+        {
+            TOGFuture<FGameplayEventData> Future = OGAsync::WaitGameplayEvent(Ability, TAG_OGAsyncTest_Event);
+            FString Reason;
+            Future->WeakCatch(Owner, [&Reason](const FString& InReason) { Reason = InReason; });
+
+            AbilitySystem->CancelAbilityHandle(Handle);
+            TestTrue(TEXT("Ending the ability should reject the wait"), Future->IsRejected());
+            TestFalse(TEXT("Rejection should have a reason"), Reason.IsEmpty());
+
+            FGameplayEventData Payload;
+            AbilitySystem->HandleGameplayEvent(TAG_OGAsyncTest_Event, &Payload);
+            TestTrue(TEXT("Later events should not reach the ended wait"), Future->IsRejected());
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncGASWaitDelayTest, "OccamsGamekit.OGAsync.GAS.WaitDelay",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncGASWaitDelayTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+    WorldWrapper.BeginPlayInTestWorld();
+
+    AActor* Owner = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{Owner->Destroy();};
+    UAbilitySystemComponent* AbilitySystem = MakeAbilitySystem(Owner);
+
+    // Test 1: Resolves once the world has ticked past the delay
+    {
+        TOGFuture<void> NextTick = OGAsync::WaitDelay(Owner, 0.f);
+        TOGFuture<void> Delayed = OGAsync::WaitDelay(Owner, 0.5f);
+        TestTrue(TEXT("Wait should not resolve before the world ticks"), NextTick->IsPending());
+
+        WorldWrapper.TickWorld(0.1f);
+        TestTrue(TEXT("Zero delay should resolve on the next tick"), NextTick->IsFulfilled());
+        TestTrue(TEXT("Longer delay should still be pending"), Delayed->IsPending());
+
+        for (int32 Tick = 0; Tick < 5; ++Tick)
+        {
+            WorldWrapper.TickWorld(0.1f);
+        }
+        TestTrue(TEXT("Longer delay should resolve once it has elapsed"), Delayed->IsFulfilled());
+    }
+
+    // Test 2: No world rejects immediately
+    {
+        TestTrue(TEXT("Null context should reject"), OGAsync::WaitDelay(static_cast<const UObject*>(nullptr), 1.f)->IsRejected());
+    }
+
+    // Test 3: Ending the ability rejects the wait and clears its timer
+    {
+        FGameplayAbilitySpecHandle Handle;
+        UGameplayAbility* Ability = ActivateTestAbility(AbilitySystem, Handle);
+        if (TestNotNull(TEXT("Test ability should activate"), Ability))
+        {
+            TOGFuture<void> Future = OGAsync::WaitDelay(Ability, 0.f);
+            AbilitySystem->CancelAbilityHandle(Handle);
+            TestTrue(TEXT("Ending the ability should reject the wait"), Future->IsRejected());
+
+            WorldWrapper.TickWorld(0.1f);
+            TestTrue(TEXT("The cleared timer should not fire"), Future->IsRejected());
+        }
+    }
+
+    return true;
+}
+
+#endif
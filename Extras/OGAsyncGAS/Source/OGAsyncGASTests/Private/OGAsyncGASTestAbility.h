@@ -0,0 +1,24 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbility.h"
+#include "OGAsyncGASTestAbility.generated.h"
+
+//Instanced ability that stays active until it is cancelled, so the waits tied to it can be tested. Lives in the test
+//module so it is never reflected in a shipping build
+UCLASS(NotBlueprintable, HideDropdown)
+class UOGAsyncGASTestAbility : public UGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UOGAsyncGASTestAbility()
+	{
+		InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	}
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override {}
+};
@@ -0,0 +1,5 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncGASTestsModule.h"
+	
+IMPLEMENT_MODULE(FOGAsyncGASTestsModule, OGAsyncGASTests)
@@ -0,0 +1,15 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+/**
+ * 
+ */
+class FOGAsyncGASTestsModule : public IModuleInterface
+{
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override {}
+	virtual void ShutdownModule() override {}
+};
@@ -26,6 +26,8 @@ public class OGAsync : ModuleRules
 			new string[]
 			{
 				"Core",
+				"RenderCore",
+				"RHI",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
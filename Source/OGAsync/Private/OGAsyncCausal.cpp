@@ -0,0 +1,205 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncCausal.h"
+
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/ScopeLock.h"
+#include "OGAsyncSingleton.h"
+#include "OGFuture.h"
+
+#if OGASYNC_CAUSAL_CHAINS
+
+bool OGAsync::Private::bCaptureCausalChains = false;
+const FString* OGAsync::Private::ReportedRejection = nullptr;
+
+namespace
+{
+	FAutoConsoleVariableRef CVarCausalChains(
+		TEXT("OGAsync.CausalChains"),
+		OGAsync::Private::bCaptureCausalChains,
+		TEXT("Record where every future was made and what it continues, and log the causal path of rejections and slow futures."));
+
+	float SlowSeconds = 5.f;
+	FAutoConsoleVariableRef CVarCausalChainsSlowSeconds(
+		TEXT("OGAsync.CausalChains.SlowSeconds"),
+		SlowSeconds,
+		TEXT("Log the causal path of futures that take longer than this to resolve while OGAsync.CausalChains is set. 0 disables it."));
+
+	int32 ReportsPerFrame = 4;
+	FAutoConsoleVariableRef CVarCausalChainsReportsPerFrame(
+		TEXT("OGAsync.CausalChains.ReportsPerFrame"),
+		ReportsPerFrame,
+		TEXT("How many queued causal paths are symbolicated and logged each frame."));
+
+	FAutoConsoleCommand FlushCausalReportsCommand(
+		TEXT("OGAsync.CausalChains.Flush"),
+		TEXT("Logs every queued causal path now."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			OGAsync::Private::FlushCausalReports();
+		}));
+
+	constexpr int32 MaxChainLength = 64;
+	//Reports past this are dropped and counted, a burst of rejections shouldn't grow the queue without bound
+	constexpr int32 MaxQueuedReports = 256;
+
+	//Frames of OGAsync itself and the plumbing it goes through, matched against the symbol name
+	const ANSICHAR* const InternalSymbols[] = {
+		"FOGFutureState::",
+		"TOGFutureState<",
+		"TOGFuture<",
+		"TOGPromise<",
+		"OGAsync::Private::",
+		"SharedPointerInternals::",
+		"MakeShared<",
+		"PlatformStackWalk::",
+	};
+
+	bool IsInternalFrame(const ANSICHAR* Symbol)
+	{
+		for (const ANSICHAR* Internal : InternalSymbols)
+		{
+			if (FCStringAnsi::Strstr(Symbol, Internal))
+				return true;
+		}
+		return false;
+	}
+
+	struct FCausalReport
+	{
+		TSharedRef<FOGCausalNode> Node;
+		FString Header;
+	};
+
+	struct FCausalReportQueue
+	{
+		void Add(const TSharedRef<FOGCausalNode>& Node, FString&& Header)
+		{
+			FScopeLock Lock(&Mutex);
+			if (Reports.Num() >= MaxQueuedReports)
+			{
+				++NumDropped;
+				return;
+			}
+			Reports.Add(FCausalReport{Node, MoveTemp(Header)});
+
+			if (!TickerHandle.IsValid())
+			{
+				TickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("OGAsyncCausalReports"), 0.f, [](float DeltaTime)
+				{
+					OGAsync::Private::FlushCausalReports(ReportsPerFrame);
+					return true;
+				});
+			}
+		}
+
+		FCriticalSection Mutex;
+		TArray<FCausalReport> Reports;
+		int32 NumDropped = 0;
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+}
+
+//Captures the whole stack, OGAsync's own frames at the top are skipped when it is printed
+TSharedPtr<FOGCausalNode> OGAsync::Private::CaptureCausalNode()
+{
+	TSharedPtr<FOGCausalNode> Node = MakeShared<FOGCausalNode>();
+	Node->NumFrames = static_cast<int32>(FPlatformStackWalk::CaptureStackBackTrace(Node->ProgramCounters, FOGCausalNode::MaxFrames));
+	Node->CreatedCycles = FPlatformTime::Cycles64();
+	return Node;
+}
+
+FString OGAsync::Private::DescribeCausalChain(const FOGCausalNode& Node)
+{
+	FString Description;
+	int32 Link = 0;
+	for (const FOGCausalNode* Current = &Node; Current && Link < MaxChainLength; Current = Current->Parent.Get(), ++Link)
+	{
+		Description += Link == 0 ? TEXT("  made") : TEXT("  continuing a future made");
+		if (Current->CallSite.IsSet())
+		{
+			Description += FString::Printf(TEXT(" at %s"), *Current->CallSite.ToString());
+		}
+		Description += TEXT(":\n");
+
+		int32 NumPrinted = 0;
+		for (int32 Frame = 0; Frame < Current->NumFrames && NumPrinted < FOGCausalNode::MaxCallerFrames; ++Frame)
+		{
+			ANSICHAR Symbol[1024];
+			Symbol[0] = 0;
+			FPlatformStackWalk::ProgramCounterToHumanReadableString(Frame, Current->ProgramCounters[Frame], Symbol, UE_ARRAY_COUNT(Symbol));
+			if (IsInternalFrame(Symbol))
+				continue;
+
+			Description += FString::Printf(TEXT("    %s\n"), ANSI_TO_TCHAR(Symbol));
+			++NumPrinted;
+		}
+	}
+	return Description;
+}
+
+void OGAsync::Private::ReportRejection(const TSharedRef<FOGCausalNode>& Node, const FString& Reason)
+{
+	OGAsync::Private::GetLeakedSingleton<FCausalReportQueue>().Add(Node, FString::Printf(TEXT("Future rejected with \"%s\""), *Reason));
+}
+
+void OGAsync::Private::ReportIfSlow(const TSharedRef<FOGCausalNode>& Node)
+{
+	if (SlowSeconds <= 0.f)
+		return;
+
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Node->CreatedCycles);
+	if (Seconds >= SlowSeconds)
+	{
+		OGAsync::Private::GetLeakedSingleton<FCausalReportQueue>().Add(Node, FString::Printf(TEXT("Future took %.2fs to resolve"), Seconds));
+	}
+}
+
+//Reports are taken off the queue under the lock and symbolicated outside it
+int32 OGAsync::Private::FlushCausalReports(int32 MaxReports)
+{
+	FCausalReportQueue& Queue = OGAsync::Private::GetLeakedSingleton<FCausalReportQueue>();
+	TArray<FCausalReport> Reports;
+	int32 NumDropped = 0;
+	{
+		FScopeLock Lock(&Queue.Mutex);
+		const int32 NumToTake = FMath::Clamp(MaxReports, 0, Queue.Reports.Num());
+		Reports.Append(Queue.Reports.GetData(), NumToTake);
+		Queue.Reports.RemoveAt(0, NumToTake);
+		Swap(NumDropped, Queue.NumDropped);
+	}
+
+	for (const FCausalReport& Report : Reports)
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("%s, causal path:\n%s"), *Report.Header, *DescribeCausalChain(*Report.Node));
+	}
+	if (NumDropped > 0)
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("Dropped %d causal paths, more than %d were queued"), NumDropped, MaxQueuedReports);
+	}
+	return Reports.Num();
+}
+
+int32 OGAsync::Private::GetNumQueuedCausalReports()
+{
+	FCausalReportQueue& Queue = OGAsync::Private::GetLeakedSingleton<FCausalReportQueue>();
+	FScopeLock Lock(&Queue.Mutex);
+	return Queue.Reports.Num();
+}
+
+FString FOGFutureState::DescribeCausalChain() const
+{
+	return CausalNode.IsValid() ? OGAsync::Private::DescribeCausalChain(*CausalNode) : FString();
+}
+
+#else
+
+FString FOGFutureState::DescribeCausalChain() const
+{
+	return FString();
+}
+
+#endif
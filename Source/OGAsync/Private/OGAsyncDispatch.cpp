@@ -0,0 +1,55 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncDispatch.h"
+
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "OGAsyncMemory.h"
+#include "OGAsyncStats.h"
+
+namespace
+{
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> GameThreadQueue;
+	std::atomic<bool> bGameThreadDrainScheduled = false;
+#if CSV_PROFILER
+	std::atomic<int32> NumQueuedForGameThread = 0;
+#endif
+}
+
+void OGAsync::RunOnGameThread(TUniqueFunction<void()>&& Work)
+{
+	OGASYNC_LLM_SCOPE();
+#if CSV_PROFILER
+	NumQueuedForGameThread.fetch_add(1, std::memory_order_relaxed);
+	if (!IsInGameThread())
+	{
+		CSV_CUSTOM_STAT(OGAsync, CrossThreadMarshals, 1, ECsvCustomStatOp::Accumulate);
+	}
+#endif
+	GameThreadQueue.Enqueue(MoveTemp(Work));
+	if (!bGameThreadDrainScheduled.exchange(true))
+	{
+		AsyncTask(ENamedThreads::GameThread, []()
+		{
+			FlushGameThreadQueue();
+		});
+	}
+}
+
+void OGAsync::FlushGameThreadQueue()
+{
+	check(IsInGameThread());
+
+	//Clear the flag before draining so anything queued while we run schedules another batch
+	bGameThreadDrainScheduled = false;
+	CSV_CUSTOM_STAT(OGAsync, GameThreadBacklog, NumQueuedForGameThread.load(std::memory_order_relaxed), ECsvCustomStatOp::Max);
+	TUniqueFunction<void()> Work;
+	while (GameThreadQueue.Dequeue(Work))
+	{
+#if CSV_PROFILER
+		NumQueuedForGameThread.fetch_sub(1, std::memory_order_relaxed);
+#endif
+		Work();
+	}
+}
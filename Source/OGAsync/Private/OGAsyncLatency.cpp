@@ -0,0 +1,174 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncLatency.h"
+
+#include "Algo/SortBy.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "OGFuture.h"
+
+namespace
+{
+	bool bLatencyHistograms = true;
+	FAutoConsoleVariableRef CVarLatencyHistograms(
+		TEXT("OGAsync.LatencyHistograms"),
+		bLatencyHistograms,
+		TEXT("Record how long promises made with a call site take to resolve, see OGAsync.DumpLatency."));
+
+	struct FLatencySite
+	{
+		FString Name;
+		FOGLatencyHistogram Histogram;
+	};
+
+	FCriticalSection SitesMutex;
+	TMap<uint64, TUniquePtr<FLatencySite>> Sites;
+
+	FAutoConsoleCommand DumpLatencyCommand(
+		TEXT("OGAsync.DumpLatency"),
+		TEXT("Logs the p50/p95/p99/max time to resolve of promises made with a call site, slowest first."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			const TArray<FOGLatencySummary> Summaries = OGAsync::GetLatencySummaries();
+			UE_LOG(LogOGFuture, Display, TEXT("Promise latency for %d call sites (ms):"), Summaries.Num());
+			for (const FOGLatencySummary& Summary : Summaries)
+			{
+				UE_LOG(LogOGFuture, Display, TEXT("  %8llu  p50 %9.3f  p95 %9.3f  p99 %9.3f  max %9.3f  %s"),
+					Summary.Count, Summary.P50Ms, Summary.P95Ms, Summary.P99Ms, Summary.MaxMs, *Summary.CallSite);
+			}
+		}));
+}
+
+void FOGLatencyHistogram::Record(uint64 Microseconds)
+{
+	Buckets[GetBucketIndex(Microseconds)].fetch_add(1, std::memory_order_relaxed);
+	if (Microseconds > MaxMicroseconds.load(std::memory_order_relaxed))
+	{
+		MaxMicroseconds.store(Microseconds, std::memory_order_relaxed);
+	}
+}
+
+void FOGLatencyHistogram::MergeInto(TArrayView<uint64> OutCounts) const
+{
+	check(OutCounts.Num() == NumBuckets);
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		OutCounts[Index] += Buckets[Index].load(std::memory_order_relaxed);
+	}
+}
+
+void FOGLatencyHistogram::Reset()
+{
+	for (std::atomic<uint32>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	MaxMicroseconds.store(0, std::memory_order_relaxed);
+}
+
+int32 FOGLatencyHistogram::GetBucketIndex(uint64 Microseconds)
+{
+	//Values below SubBucketCount get a bucket each, above that the top SubBucketBits below the leading bit pick the bucket
+	if (Microseconds < SubBucketCount)
+		return static_cast<int32>(Microseconds);
+
+	const int32 Exponent = FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Microseconds)), MaxExponent);
+	const uint64 Clamped = FMath::Min(Microseconds, (uint64(1) << (MaxExponent + 1)) - 1);
+	const int32 SubBucket = static_cast<int32>((Clamped >> (Exponent - SubBucketBits)) - SubBucketCount);
+	return (Exponent - SubBucketBits + 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FOGLatencyHistogram::GetBucketValue(int32 Index)
+{
+	if (Index < SubBucketCount)
+		return Index;
+
+	const int32 Exponent = Index / SubBucketCount + SubBucketBits - 1;
+	const uint64 Width = uint64(1) << (Exponent - SubBucketBits);
+	const uint64 LowerBound = (SubBucketCount + Index % SubBucketCount) * Width;
+	return LowerBound + Width / 2;
+}
+
+uint64 FOGLatencyHistogram::GetPercentile(TConstArrayView<uint64> Counts, double Percentile)
+{
+	uint64 Total = 0;
+	for (const uint64 Count : Counts)
+	{
+		Total += Count;
+	}
+	if (Total == 0)
+		return 0;
+
+	const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(Percentile * Total)));
+	uint64 Seen = 0;
+	for (int32 Index = 0; Index < Counts.Num(); ++Index)
+	{
+		Seen += Counts[Index];
+		if (Seen >= Rank)
+			return GetBucketValue(Index);
+	}
+	return GetBucketValue(Counts.Num() - 1);
+}
+
+TArray<FOGLatencySummary> OGAsync::GetLatencySummaries()
+{
+	TArray<FOGLatencySummary> Summaries;
+	TArray<uint64> Counts;
+	FScopeLock Lock(&SitesMutex);
+	for (const TPair<uint64, TUniquePtr<FLatencySite>>& Site : Sites)
+	{
+		Counts.Reset();
+		Counts.SetNumZeroed(FOGLatencyHistogram::NumBuckets);
+		Site.Value->Histogram.MergeInto(Counts);
+
+		FOGLatencySummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.CallSite = Site.Value->Name;
+		for (const uint64 Count : Counts)
+		{
+			Summary.Count += Count;
+		}
+		Summary.P50Ms = FOGLatencyHistogram::GetPercentile(Counts, 0.50) / 1000.0;
+		Summary.P95Ms = FOGLatencyHistogram::GetPercentile(Counts, 0.95) / 1000.0;
+		Summary.P99Ms = FOGLatencyHistogram::GetPercentile(Counts, 0.99) / 1000.0;
+		Summary.MaxMs = Site.Value->Histogram.GetMaxMicroseconds() / 1000.0;
+	}
+
+	Algo::SortBy(Summaries, &FOGLatencySummary::P99Ms, TGreater<>());
+	return Summaries;
+}
+
+void OGAsync::ResetLatencyHistograms()
+{
+	FScopeLock Lock(&SitesMutex);
+	for (const TPair<uint64, TUniquePtr<FLatencySite>>& Site : Sites)
+	{
+		Site.Value->Histogram.Reset();
+	}
+}
+
+FOGLatencyHistogram* OGAsync::Private::FindOrAddLatencyHistogram(const FOGCallSite& CallSite)
+{
+	if (!bLatencyHistograms || !CallSite.IsSet())
+		return nullptr;
+
+	//Sites are never removed, so once a call site has cached its histogram it can skip the lock for good
+	if (CallSite.CachedHistogram)
+	{
+		if (FOGLatencyHistogram* Cached = CallSite.CachedHistogram->load(std::memory_order_acquire)) [[likely]]
+			return Cached;
+	}
+
+	FScopeLock Lock(&SitesMutex);
+	TUniquePtr<FLatencySite>& Site = Sites.FindOrAdd(CallSite.GetId());
+	if (!Site.IsValid())
+	{
+		Site = MakeUnique<FLatencySite>();
+		Site->Name = CallSite.ToString();
+	}
+	if (CallSite.CachedHistogram)
+	{
+		CallSite.CachedHistogram->store(&Site->Histogram, std::memory_order_release);
+	}
+	return &Site->Histogram;
+}
@@ -0,0 +1,74 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncMemory.h"
+
+#include "Algo/SortBy.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "OGAsyncSingleton.h"
+#include "OGFuture.h"
+
+LLM_DEFINE_TAG(OGAsync);
+
+std::atomic<int64> OGAsync::Private::CallbackBytes = 0;
+
+namespace
+{
+	struct FStateTypeRegistry
+	{
+		FCriticalSection Mutex;
+		TMap<FString, TUniquePtr<OGAsync::Private::FStateTypeMemory>> Types;
+	};
+
+	FAutoConsoleCommand MemReportCommand(
+		TEXT("OGAsync.MemReport"),
+		TEXT("Logs the memory held by live future states per value type, by their values and by pending callbacks."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			const FOGAsyncMemoryReport Report = OGAsync::GetMemoryReport();
+			int64 TotalBytes = Report.CallbackBytes;
+			UE_LOG(LogOGFuture, Display, TEXT("OGAsync memory:"));
+			UE_LOG(LogOGFuture, Display, TEXT("  %10s  %12s  %12s  %s"), TEXT("Live"), TEXT("States"), TEXT("Payload"), TEXT("Type"));
+			for (const FOGAsyncMemoryReport::FStateType& Type : Report.StateTypes)
+			{
+				UE_LOG(LogOGFuture, Display, TEXT("  %10lld  %12lld  %12lld  %s"), Type.NumLive, Type.StateBytes, Type.PayloadBytes, *Type.TypeName);
+				TotalBytes += Type.StateBytes + Type.PayloadBytes;
+			}
+			UE_LOG(LogOGFuture, Display, TEXT("  Callback storage %lld bytes, %lld bytes in total"), Report.CallbackBytes, TotalBytes);
+		}));
+}
+
+OGAsync::Private::FStateTypeMemory& OGAsync::Private::RegisterStateType(const ANSICHAR* TypeName, SIZE_T StateSize)
+{
+	FStateTypeRegistry& Registry = OGAsync::Private::GetLeakedSingleton<FStateTypeRegistry>();
+	FScopeLock Lock(&Registry.Mutex);
+	TUniquePtr<FStateTypeMemory>& Type = Registry.Types.FindOrAdd(FString(TypeName));
+	if (!Type.IsValid())
+	{
+		Type = MakeUnique<FStateTypeMemory>();
+		Type->TypeName = FString(TypeName);
+		Type->StateSize = StateSize;
+	}
+	return *Type;
+}
+
+FOGAsyncMemoryReport OGAsync::GetMemoryReport()
+{
+	FOGAsyncMemoryReport Report;
+	Report.CallbackBytes = Private::CallbackBytes.load(std::memory_order_relaxed);
+
+	FStateTypeRegistry& Registry = OGAsync::Private::GetLeakedSingleton<FStateTypeRegistry>();
+	FScopeLock Lock(&Registry.Mutex);
+	for (const TPair<FString, TUniquePtr<Private::FStateTypeMemory>>& Type : Registry.Types)
+	{
+		FOGAsyncMemoryReport::FStateType& Entry = Report.StateTypes.AddDefaulted_GetRef();
+		Entry.TypeName = Type.Key;
+		Entry.NumLive = Type.Value->NumLive.load(std::memory_order_relaxed);
+		Entry.StateBytes = Entry.NumLive * static_cast<int64>(Type.Value->StateSize);
+		Entry.PayloadBytes = Type.Value->PayloadBytes.load(std::memory_order_relaxed);
+	}
+
+	Algo::SortBy(Report.StateTypes, [](const FOGAsyncMemoryReport::FStateType& Type) { return Type.StateBytes + Type.PayloadBytes; }, TGreater<>());
+	return Report;
+}
@@ -0,0 +1,117 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncParallel.h"
+
+#include "Async/TaskGraphInterfaces.h"
+
+namespace
+{
+	//Enough chunks per worker that stealing can even out uneven bodies, without making the chunks tiny
+	constexpr int32 ChunksPerWorker = 8;
+
+	uint64 PackRange(int32 Begin, int32 End)
+	{
+		return static_cast<uint64>(static_cast<uint32>(Begin)) | (static_cast<uint64>(static_cast<uint32>(End)) << 32);
+	}
+
+	void UnpackRange(uint64 Packed, int32& OutBegin, int32& OutEnd)
+	{
+		OutBegin = static_cast<int32>(static_cast<uint32>(Packed));
+		OutEnd = static_cast<int32>(static_cast<uint32>(Packed >> 32));
+	}
+}
+
+int32 OGAsync::Private::GetNumParallelWorkers(const FOGParallelOptions& Options)
+{
+	const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+	return Options.MaxWorkers > 0 ? FMath::Min(NumWorkers, Options.MaxWorkers) : NumWorkers;
+}
+
+OGAsync::Private::FOGWorkStealingRanges::FOGWorkStealingRanges(int32 Num, const FOGParallelOptions& Options)
+{
+	const int32 MinGrainSize = FMath::Max(1, Options.MinGrainSize);
+	//No point waking workers that would never get a chunk of their own
+	const int32 NumWorkers = FMath::Clamp(FMath::DivideAndRoundUp(Num, MinGrainSize), 1, GetNumParallelWorkers(Options));
+	GrainSize = FMath::Max(MinGrainSize, Num / (NumWorkers * ChunksPerWorker));
+
+	Ranges.SetNum(NumWorkers);
+	for (int32 Worker = 0; Worker < NumWorkers; ++Worker)
+	{
+		const int32 Begin = static_cast<int32>(static_cast<int64>(Num) * Worker / NumWorkers);
+		const int32 End = static_cast<int32>(static_cast<int64>(Num) * (Worker + 1) / NumWorkers);
+		Ranges[Worker].Value.store(PackRange(Begin, End), std::memory_order_relaxed);
+	}
+}
+
+bool OGAsync::Private::FOGWorkStealingRanges::Claim(int32 Worker, int32& OutBegin, int32& OutEnd)
+{
+	if (TryPopFront(Worker, OutBegin, OutEnd))
+		return true;
+
+	for (int32 Offset = 1; Offset < Ranges.Num(); ++Offset)
+	{
+		if (TrySteal(Worker, (Worker + Offset) % Ranges.Num(), OutBegin, OutEnd))
+			return true;
+	}
+	//Another worker may still be mid-steal, but it will process whatever it took itself
+	return false;
+}
+
+bool OGAsync::Private::FOGWorkStealingRanges::TryPopFront(int32 Worker, int32& OutBegin, int32& OutEnd)
+{
+	std::atomic<uint64>& Range = Ranges[Worker].Value;
+	uint64 Packed = Range.load(std::memory_order_acquire);
+	while (true)
+	{
+		int32 Begin, End;
+		UnpackRange(Packed, Begin, End);
+		if (Begin >= End)
+			return false;
+
+		const int32 ChunkEnd = FMath::Min(Begin + GrainSize, End);
+		if (Range.compare_exchange_weak(Packed, PackRange(ChunkEnd, End), std::memory_order_acq_rel))
+		{
+			OutBegin = Begin;
+			OutEnd = ChunkEnd;
+			return true;
+		}
+	}
+}
+
+bool OGAsync::Private::FOGWorkStealingRanges::TrySteal(int32 Worker, int32 Victim, int32& OutBegin, int32& OutEnd)
+{
+	std::atomic<uint64>& VictimRange = Ranges[Victim].Value;
+	uint64 Packed = VictimRange.load(std::memory_order_acquire);
+	while (true)
+	{
+		int32 Begin, End;
+		UnpackRange(Packed, Begin, End);
+		const int32 Remaining = End - Begin;
+		if (Remaining <= 0)
+			return false;
+
+		//Not worth splitting, take the last chunk whole
+		if (Remaining <= GrainSize)
+		{
+			if (VictimRange.compare_exchange_weak(Packed, PackRange(End, End), std::memory_order_acq_rel))
+			{
+				OutBegin = Begin;
+				OutEnd = End;
+				return true;
+			}
+			continue;
+		}
+
+		const int32 Mid = Begin + Remaining / 2;
+		if (VictimRange.compare_exchange_weak(Packed, PackRange(Begin, Mid), std::memory_order_acq_rel))
+		{
+			//Our own range is empty, so nobody else will touch it until we publish the stolen half
+			const int32 ChunkEnd = FMath::Min(Mid + GrainSize, End);
+			Ranges[Worker].Value.store(PackRange(ChunkEnd, End), std::memory_order_release);
+			OutBegin = Mid;
+			OutEnd = ChunkEnd;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,217 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncPending.h"
+
+#include "Algo/SortBy.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "OGAsyncSingleton.h"
+#include "OGFuture.h"
+
+#if OGASYNC_TRACK_PENDING
+
+bool OGAsync::Private::bTrackPending = false;
+
+namespace
+{
+	//Off by default, every state created while it is on allocates a registry node
+	FAutoConsoleVariableRef CVarTrackPending(
+		TEXT("OGAsync.TrackPending"),
+		OGAsync::Private::bTrackPending,
+		TEXT("Keep a registry of futures created from now on that have not resolved yet, see OGAsync.DumpPending. Every state allocates a small node to join it."));
+
+	float PendingWarnSeconds = 30.f;
+	FAutoConsoleVariableRef CVarPendingWarnSeconds(
+		TEXT("OGAsync.PendingWarnSeconds"),
+		PendingWarnSeconds,
+		TEXT("Warn once about every future that has been pending for longer than this. 0 disables the warning."));
+
+	FAutoConsoleCommand DumpPendingCommand(
+		TEXT("OGAsync.DumpPending"),
+		TEXT("Logs the futures that have not resolved yet. OGAsync.DumpPending [N] [wide], N defaults to 20, wide sorts by subscriber count instead of age."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			int32 MaxCount = 20;
+			bool bWidestFirst = false;
+			for (const FString& Arg : Args)
+			{
+				if (Arg.IsNumeric())
+				{
+					MaxCount = FCString::Atoi(*Arg);
+				}
+				else if (Arg.Equals(TEXT("wide"), ESearchCase::IgnoreCase))
+				{
+					bWidestFirst = true;
+				}
+			}
+
+			const TArray<FOGPendingFutureInfo> Pending = OGAsync::GetPendingFutures(MaxCount, bWidestFirst);
+			UE_LOG(LogOGFuture, Display, TEXT("%d futures pending, showing %d %s:"), OGAsync::GetNumPendingFutures(), Pending.Num(), bWidestFirst ? TEXT("widest") : TEXT("oldest"));
+			for (const FOGPendingFutureInfo& Info : Pending)
+			{
+				UE_LOG(LogOGFuture, Display, TEXT("  %10.2fs  %4d subscribers  %s"), Info.AgeSeconds, Info.NumSubscribers, Info.CallSite.IsEmpty() ? TEXT("(no call site)") : *Info.CallSite);
+			}
+		}));
+}
+
+//New nodes are pushed onto Incoming from any thread. The game thread moves them to the settled list, which it alone
+//owns, whenever it walks the registry, freeing the nodes of states that have resolved or died since
+struct FOGPendingRegistry
+{
+	FOGPendingNode* Link()
+	{
+		FOGPendingNode* Node = new FOGPendingNode();
+		Node->LinkedCycles = FPlatformTime::Cycles64();
+		FOGPendingNode* Head = Incoming.load(std::memory_order_relaxed);
+		do
+		{
+			Node->Next = Head;
+		}
+		while (!Incoming.compare_exchange_weak(Head, Node, std::memory_order_release, std::memory_order_relaxed));
+		Num.fetch_add(1, std::memory_order_relaxed);
+
+		if (!bWatchdogStarted.exchange(true, std::memory_order_relaxed)) [[unlikely]]
+		{
+			FTSTicker::GetCoreTicker().AddTicker(TEXT("OGAsyncPendingWatchdog"), 1.f, [this](float DeltaTime)
+			{
+				CheckForStalls();
+				return true;
+			});
+		}
+		return Node;
+	}
+
+	void Unlink(FOGPendingNode* Node)
+	{
+		Num.fetch_sub(1, std::memory_order_relaxed);
+		Node->bDone.store(true, std::memory_order_release);
+	}
+
+	//Game thread. Incoming is newest first, so it is reversed before being appended to keep the settled list oldest first
+	void Sweep()
+	{
+		FOGPendingNode* Newest = Incoming.exchange(nullptr, std::memory_order_acquire);
+		FOGPendingNode* const NewTail = Newest;
+		FOGPendingNode* Oldest = nullptr;
+		while (Newest)
+		{
+			FOGPendingNode* Next = Newest->Next;
+			Newest->Next = Oldest;
+			Oldest = Newest;
+			Newest = Next;
+		}
+		if (Oldest)
+		{
+			(SettledTail ? SettledTail->Next : SettledHead) = Oldest;
+			SettledTail = NewTail;
+		}
+
+		FOGPendingNode* Previous = nullptr;
+		for (FOGPendingNode** Link = &SettledHead; *Link;)
+		{
+			FOGPendingNode* Node = *Link;
+			if (Node->bDone.load(std::memory_order_acquire))
+			{
+				*Link = Node->Next;
+				delete Node;
+			}
+			else
+			{
+				Previous = Node;
+				Link = &Node->Next;
+			}
+		}
+		SettledTail = Previous;
+	}
+
+	//Walks from the oldest node and stops at the first one under the threshold, done nodes are swept first
+	void CheckForStalls()
+	{
+		Sweep();
+		if (PendingWarnSeconds <= 0.f)
+			return;
+
+		const uint64 Now = FPlatformTime::Cycles64();
+		for (FOGPendingNode* Node = SettledHead; Node; Node = Node->Next)
+		{
+			const double AgeSeconds = FPlatformTime::ToSeconds64(Now - Node->LinkedCycles);
+			if (AgeSeconds < PendingWarnSeconds)
+				break;
+
+			if (!Node->bStallReported && !Node->bDone.load(std::memory_order_acquire))
+			{
+				Node->bStallReported = true;
+				UE_LOG(LogOGFuture, Warning, TEXT("Future has been pending for %.1fs with %d subscribers, made at %s"), AgeSeconds, Node->NumSubscribers,
+					Node->CallSite.IsSet() ? *Node->CallSite.ToString() : TEXT("(no call site, pass an FOGCallSite when making the promise)"));
+			}
+		}
+	}
+
+	TArray<FOGPendingFutureInfo> GetPending(int32 MaxCount, bool bWidestFirst)
+	{
+		Sweep();
+		TArray<FOGPendingFutureInfo> Infos;
+		const uint64 Now = FPlatformTime::Cycles64();
+		for (FOGPendingNode* Node = SettledHead; Node && (bWidestFirst || Infos.Num() < MaxCount); Node = Node->Next)
+		{
+			//The state may have resolved on another thread since the sweep
+			if (Node->bDone.load(std::memory_order_acquire))
+				continue;
+
+			FOGPendingFutureInfo& Info = Infos.AddDefaulted_GetRef();
+			Info.CallSite = Node->CallSite.IsSet() ? Node->CallSite.ToString() : FString();
+			Info.AgeSeconds = FPlatformTime::ToSeconds64(Now - Node->LinkedCycles);
+			Info.NumSubscribers = Node->NumSubscribers;
+		}
+
+		if (bWidestFirst)
+		{
+			Algo::SortBy(Infos, &FOGPendingFutureInfo::NumSubscribers, TGreater<>());
+			Infos.SetNum(FMath::Min(Infos.Num(), FMath::Max(0, MaxCount)));
+		}
+		return Infos;
+	}
+
+	std::atomic<FOGPendingNode*> Incoming = nullptr;
+	std::atomic<int32> Num = 0;
+	std::atomic<bool> bWatchdogStarted = false;
+	//Game thread only
+	FOGPendingNode* SettledHead = nullptr;
+	FOGPendingNode* SettledTail = nullptr;
+};
+
+FOGPendingNode* OGAsync::Private::LinkPendingNode()
+{
+	return OGAsync::Private::GetLeakedSingleton<FOGPendingRegistry>().Link();
+}
+
+void OGAsync::Private::UnlinkPendingNode(FOGPendingNode* Node)
+{
+	OGAsync::Private::GetLeakedSingleton<FOGPendingRegistry>().Unlink(Node);
+}
+
+int32 OGAsync::GetNumPendingFutures()
+{
+	return OGAsync::Private::GetLeakedSingleton<FOGPendingRegistry>().Num.load(std::memory_order_relaxed);
+}
+
+TArray<FOGPendingFutureInfo> OGAsync::GetPendingFutures(int32 MaxCount, bool bWidestFirst)
+{
+	check(IsInGameThread());
+	return OGAsync::Private::GetLeakedSingleton<FOGPendingRegistry>().GetPending(MaxCount, bWidestFirst);
+}
+
+#else
+
+int32 OGAsync::GetNumPendingFutures()
+{
+	return 0;
+}
+
+TArray<FOGPendingFutureInfo> OGAsync::GetPendingFutures(int32 MaxCount, bool bWidestFirst)
+{
+	return TArray<FOGPendingFutureInfo>();
+}
+
+#endif
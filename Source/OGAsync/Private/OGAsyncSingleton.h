@@ -0,0 +1,17 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace OGAsync::Private
+{
+	//For the registries future states reach as they are made, resolved and destroyed. The instance is never destroyed,
+	//since states held by other statics can still be destroyed during shutdown, after this module's statics are gone
+	template<typename T>
+	T& GetLeakedSingleton()
+	{
+		static T& Instance = *new T();
+		return Instance;
+	}
+}
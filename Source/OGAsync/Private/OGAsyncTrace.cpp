@@ -0,0 +1,149 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncTrace.h"
+
+#if OGASYNC_TRACE_ENABLED
+
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(OGAsyncChannel);
+
+UE_TRACE_EVENT_BEGIN(OGAsync, StateCreated, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, StateDestroyed, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, CallSiteSpec, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint64, CallSite)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, StateCallSite, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+	UE_TRACE_EVENT_FIELD(uint64, CallSite)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, CallbackRegistered, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, Resolved, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+	UE_TRACE_EVENT_FIELD(bool, bRejected)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, DispatchBegin, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, DispatchEnd, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(OGAsync, ContinuationLink, NoSync)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, Parent)
+	UE_TRACE_EVENT_FIELD(uint64, Child)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+	uint64 GetTraceId(const void* Pointer)
+	{
+		return static_cast<uint64>(reinterpret_cast<UPTRINT>(Pointer));
+	}
+
+	//Each call site is named once, so per state events only carry its id
+	void OutputCallSiteSpec(uint64 CallSiteId, const FOGCallSite& CallSite)
+	{
+		static FCriticalSection Mutex;
+		static TSet<uint64> SentCallSites;
+		{
+			FScopeLock Lock(&Mutex);
+			bool bAlreadySent = false;
+			SentCallSites.Add(CallSiteId, &bAlreadySent);
+			if (bAlreadySent)
+				return;
+		}
+
+		const FString Name = CallSite.ToString();
+		UE_TRACE_LOG(OGAsync, CallSiteSpec, OGAsyncChannel)
+			<< CallSiteSpec.CallSite(CallSiteId)
+			<< CallSiteSpec.Name(*Name, Name.Len());
+	}
+}
+
+void OGAsync::Trace::OutputStateCreated(const void* State)
+{
+	UE_TRACE_LOG(OGAsync, StateCreated, OGAsyncChannel)
+		<< StateCreated.Cycle(FPlatformTime::Cycles64())
+		<< StateCreated.State(GetTraceId(State));
+}
+
+void OGAsync::Trace::OutputStateDestroyed(const void* State)
+{
+	UE_TRACE_LOG(OGAsync, StateDestroyed, OGAsyncChannel)
+		<< StateDestroyed.Cycle(FPlatformTime::Cycles64())
+		<< StateDestroyed.State(GetTraceId(State));
+}
+
+void OGAsync::Trace::OutputStateCallSite(const void* State, const FOGCallSite& CallSite)
+{
+	if (!CallSite.IsSet())
+		return;
+
+	const uint64 CallSiteId = CallSite.GetId();
+	OutputCallSiteSpec(CallSiteId, CallSite);
+	UE_TRACE_LOG(OGAsync, StateCallSite, OGAsyncChannel)
+		<< StateCallSite.State(GetTraceId(State))
+		<< StateCallSite.CallSite(CallSiteId);
+}
+
+void OGAsync::Trace::OutputCallbackRegistered(const void* State)
+{
+	UE_TRACE_LOG(OGAsync, CallbackRegistered, OGAsyncChannel)
+		<< CallbackRegistered.Cycle(FPlatformTime::Cycles64())
+		<< CallbackRegistered.State(GetTraceId(State));
+}
+
+void OGAsync::Trace::OutputResolved(const void* State, bool bRejected)
+{
+	UE_TRACE_LOG(OGAsync, Resolved, OGAsyncChannel)
+		<< Resolved.Cycle(FPlatformTime::Cycles64())
+		<< Resolved.State(GetTraceId(State))
+		<< Resolved.bRejected(bRejected);
+}
+
+void OGAsync::Trace::OutputDispatchBegin(const void* State)
+{
+	UE_TRACE_LOG(OGAsync, DispatchBegin, OGAsyncChannel)
+		<< DispatchBegin.Cycle(FPlatformTime::Cycles64())
+		<< DispatchBegin.State(GetTraceId(State));
+}
+
+void OGAsync::Trace::OutputDispatchEnd(const void* State)
+{
+	UE_TRACE_LOG(OGAsync, DispatchEnd, OGAsyncChannel)
+		<< DispatchEnd.Cycle(FPlatformTime::Cycles64())
+		<< DispatchEnd.State(GetTraceId(State));
+}
+
+void OGAsync::Trace::OutputContinuationLink(const void* Parent, const void* Child)
+{
+	UE_TRACE_LOG(OGAsync, ContinuationLink, OGAsyncChannel)
+		<< ContinuationLink.Cycle(FPlatformTime::Cycles64())
+		<< ContinuationLink.Parent(GetTraceId(Parent))
+		<< ContinuationLink.Child(GetTraceId(Child));
+}
+
+#endif
@@ -0,0 +1,131 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGAsyncValue.h"
+
+#include "Algo/SortBy.h"
+#include "Containers/Ticker.h"
+
+namespace
+{
+	TArray<TWeakPtr<FOGAsyncCell>> CellsToNotify;
+	FTSTicker::FDelegateHandle NotifyTickerHandle;
+}
+
+void FOGAsyncCell::EnsureUpToDate()
+{
+	if (!bDirty)
+		return;
+
+	bDirty = false;
+	bool bDependencyChanged = false;
+	for (int32 Index = 0; Index < Dependencies.Num(); ++Index)
+	{
+		Dependencies[Index]->EnsureUpToDate();
+		if (Dependencies[Index]->GetVersion() != SeenDependencyVersions[Index])
+		{
+			SeenDependencyVersions[Index] = Dependencies[Index]->GetVersion();
+			bDependencyChanged = true;
+		}
+	}
+
+	//Recompute bumps the version itself if the result differs
+	if (bDependencyChanged)
+	{
+		Recompute();
+	}
+}
+
+void FOGAsyncCell::AddDependency(const TSharedRef<FOGAsyncCell>& Dependency)
+{
+	check(IsInGameThread());
+
+	Dependencies.Add(Dependency);
+	//Never seen, so the first EnsureUpToDate computes the value
+	SeenDependencyVersions.Add(MAX_uint64);
+	Dependency->Dependents.Add(AsShared());
+	Depth = FMath::Max(Depth, Dependency->Depth + 1);
+	bDirty = true;
+}
+
+void FOGAsyncCell::OnValueChanged()
+{
+	check(IsInGameThread());
+
+	if (HasSubscribers())
+	{
+		ScheduleNotification();
+	}
+	MarkDependentsDirty();
+}
+
+void FOGAsyncCell::MarkDependentsDirty()
+{
+	for (int32 Index = Dependents.Num() - 1; Index >= 0; --Index)
+	{
+		const TSharedPtr<FOGAsyncCell> Dependent = Dependents[Index].Pin();
+		if (!Dependent.IsValid())
+		{
+			Dependents.RemoveAtSwap(Index);
+			continue;
+		}
+
+		//Anything already dirty has already marked everything below it
+		if (Dependent->bDirty)
+			continue;
+
+		Dependent->bDirty = true;
+		if (Dependent->HasSubscribers())
+		{
+			Dependent->ScheduleNotification();
+		}
+		Dependent->MarkDependentsDirty();
+	}
+}
+
+void FOGAsyncCell::ScheduleNotification()
+{
+	if (bNotificationScheduled)
+		return;
+
+	bNotificationScheduled = true;
+	CellsToNotify.Add(AsShared());
+	if (!NotifyTickerHandle.IsValid())
+	{
+		NotifyTickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("OGAsyncValue"), 0.f, [](float DeltaTime)
+		{
+			NotifyTickerHandle.Reset();
+			FlushNotifications();
+			return false;
+		});
+	}
+}
+
+void FOGAsyncCell::FlushNotifications()
+{
+	check(IsInGameThread());
+
+	TArray<TSharedPtr<FOGAsyncCell>> Cells;
+	Cells.Reserve(CellsToNotify.Num());
+	for (const TWeakPtr<FOGAsyncCell>& WeakCell : CellsToNotify)
+	{
+		if (TSharedPtr<FOGAsyncCell> Cell = WeakCell.Pin())
+		{
+			Cell->bNotificationScheduled = false;
+			Cells.Add(MoveTemp(Cell));
+		}
+	}
+	CellsToNotify.Reset();
+
+	//Shallowest first, so a subscriber reading a deeper value never sees it half updated
+	Algo::SortBy(Cells, [](const TSharedPtr<FOGAsyncCell>& Cell) { return Cell->Depth; });
+	for (const TSharedPtr<FOGAsyncCell>& Cell : Cells)
+	{
+		Cell->EnsureUpToDate();
+		if (Cell->Version != Cell->NotifiedVersion)
+		{
+			Cell->NotifiedVersion = Cell->Version;
+			Cell->NotifySubscribers();
+		}
+	}
+}
@@ -1,17 +1,93 @@
-﻿/// Copyright Occam's Gamekit contributors 2025
-
-
-#include "OGFuture.h"
-
-DEFINE_LOG_CATEGORY(LogOGFuture);
-
-TArray<TSharedPtr<FOGFutureState>> ErrorStates;
-const FOGFuture FOGFuture::EmptyFuture(nullptr);
-const FOGPromise FOGPromise::EmptyPromise(nullptr);
-
-FOGFutureState const* FOGFuture::operator->() const
-{
-	if (!SharedState.IsValid()) [[unlikely]]
-			return TOGFutureState<void>::GetErrorState();
-	return SharedState.Get();
-}
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGFuture.h"
+
+#include "Async/ParkingLot.h"
+#include "OGAsyncLatency.h"
+
+DEFINE_LOG_CATEGORY(LogOGFuture);
+
+DEFINE_STAT(STAT_OGAsync_LiveStates);
+DEFINE_STAT(STAT_OGAsync_PendingStates);
+DEFINE_STAT(STAT_OGAsync_StatesCreated);
+DEFINE_STAT(STAT_OGAsync_StatesDestroyed);
+DEFINE_STAT(STAT_OGAsync_ContinuationsAllocated);
+DEFINE_STAT(STAT_OGAsync_CallbacksRegistered);
+DEFINE_STAT(STAT_OGAsync_CallbacksDispatched);
+DEFINE_STAT(STAT_OGAsync_Rejections);
+DEFINE_STAT(STAT_OGAsync_Dispatch);
+
+CSV_DEFINE_CATEGORY_MODULE(OGASYNC_API, OGAsync, true);
+
+TArray<TSharedPtr<FOGFutureState>> ErrorStates;
+const FOGFuture FOGFuture::EmptyFuture(nullptr);
+const FOGPromise FOGPromise::EmptyPromise(nullptr);
+
+FOGFutureState const* FOGFuture::operator->() const
+{
+	if (!SharedState.IsValid()) [[unlikely]]
+			return TOGFutureState<void>::GetErrorState();
+	return SharedState.Get();
+}
+
+bool FOGFutureState::Wait(FTimespan Timeout) const
+{
+	if (State != EState::Pending) [[likely]]
+		return true;
+
+	if (!ensureAlwaysMsgf(!IsInGameThread(), TEXT("Waiting on a future from the game thread would deadlock, the game thread is what resolves it"))) [[unlikely]]
+		return false;
+
+	const bool bWaitForever = Timeout == FTimespan::MaxValue();
+	const FMonotonicTimePoint Deadline = FMonotonicTimePoint::Now() + FMonotonicTimeSpan::FromSeconds(Timeout.GetTotalSeconds());
+
+	//Publish that someone is waiting before the final check, so a resolve racing with us either sees the flag and wakes us, or we see its state and never park
+	bHasWaiters = true;
+	while (State == EState::Pending)
+	{
+		const auto CanWait = [this]() { return State == EState::Pending; };
+		if (bWaitForever)
+		{
+			UE::ParkingLot::Wait(&State, CanWait, []() {});
+		}
+		else if (!UE::ParkingLot::WaitUntil(&State, CanWait, []() {}, Deadline).bDidWake && FMonotonicTimePoint::Now() >= Deadline)
+		{
+			break;
+		}
+	}
+	return State != EState::Pending;
+}
+
+void FOGFutureState::WakeWaiters() const
+{
+	UE::ParkingLot::WakeAll(&State);
+}
+
+void FOGFutureState::SetCallSite(const FOGCallSite& InCallSite)
+{
+	if (!ensureAlways(IsPending())) [[unlikely]]
+		return;
+
+	OGASYNC_TRACE(StateCallSite, this, InCallSite);
+#if OGASYNC_TRACK_PENDING
+	if (PendingNode)
+	{
+		PendingNode->CallSite = InCallSite;
+	}
+#endif
+#if OGASYNC_CAUSAL_CHAINS
+	if (CausalNode.IsValid())
+	{
+		CausalNode->CallSite = InCallSite;
+	}
+#endif
+	LatencyHistogram = OGAsync::Private::FindOrAddLatencyHistogram(InCallSite);
+	CreatedCycles = FPlatformTime::Cycles64();
+}
+
+void FOGFutureState::RecordLatency() const
+{
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - CreatedCycles);
+	LatencyHistogram->Record(static_cast<uint64>(Seconds * 1000000.0));
+}
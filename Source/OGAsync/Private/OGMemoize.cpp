@@ -0,0 +1,89 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGMemoize.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+	constexpr uint32 MemoFileMagic = 0x434D474F; // 'OGMC'
+
+	struct FMemoFileHeader
+	{
+		uint32 Magic = MemoFileMagic;
+		uint32 Reserved = 0;
+		uint64 PayloadSize = 0;
+	};
+
+	FString GetMemoCacheDirectory(const FString& CacheName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("OGAsync") / TEXT("Memo") / CacheName;
+	}
+}
+
+void OGAsync::ClearMemoCache(const FString& CacheName)
+{
+	if (!ensureAlways(!CacheName.IsEmpty())) [[unlikely]]
+		return;
+
+	IFileManager::Get().DeleteDirectory(*GetMemoCacheDirectory(CacheName), false, true);
+}
+
+FString OGAsync::Private::GetMemoCachePath(const FString& CacheName, const FSHAHash& Key)
+{
+	//Fan out on the first byte so no single directory collects every result
+	const FString Hex = Key.ToString();
+	return GetMemoCacheDirectory(CacheName) / Hex.Left(2) / Hex + TEXT(".bin");
+}
+
+bool OGAsync::Private::ReadMemoCacheFile(const FString& Path, TFunctionRef<bool(FArchive&)> Read)
+{
+	TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+	if (!MappedFile.IsValid() || MappedFile->GetFileSize() < static_cast<int64>(sizeof(FMemoFileHeader)))
+		return false;
+
+	TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	if (!Region.IsValid())
+		return false;
+
+	FMemoFileHeader Header;
+	FMemory::Memcpy(&Header, Region->GetMappedPtr(), sizeof(Header));
+	if (Header.Magic != MemoFileMagic || Header.PayloadSize != static_cast<uint64>(Region->GetMappedSize()) - sizeof(Header))
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("Ignoring corrupt memo cache file %s"), *Path);
+		return false;
+	}
+
+	//Deserialises straight out of the mapped pages, the payload is never copied into a buffer of its own
+	FMemoryReaderView Reader(MakeArrayView(Region->GetMappedPtr() + sizeof(Header), static_cast<int64>(Header.PayloadSize)));
+	return Read(Reader) && !Reader.IsError();
+}
+
+void OGAsync::Private::WriteMemoCacheFile(const FString& Path, const TArray<uint8>& Payload)
+{
+	FMemoFileHeader Header;
+	Header.PayloadSize = Payload.Num();
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(sizeof(Header) + Payload.Num());
+	Bytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+	Bytes.Append(Payload);
+
+	//Written next to the final path and moved into place, so a reader never maps a half written file
+	const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(Path), TEXT("Memo"), TEXT(".tmp"));
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("Failed to write memo cache file %s"), *TempPath);
+		return;
+	}
+	if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		IFileManager::Get().Delete(*TempPath);
+	}
+}
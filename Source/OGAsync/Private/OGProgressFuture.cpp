@@ -0,0 +1,131 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGProgressFuture.h"
+
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "OGFutureUtilities.h"
+
+namespace
+{
+	TQueue<TWeakPtr<FOGProgressChannel>, EQueueMode::Mpsc> QueuedChannels;
+	std::atomic<bool> bFlushTickerRegistered = false;
+}
+
+void FOGProgressChannel::SetProgress(float InProgress)
+{
+	Progress.store(FMath::Clamp(InProgress, 0.f, 1.f), std::memory_order_relaxed);
+
+	//Pairs with the fence in FlushNotifications. Either this sees the flag cleared and queues, or the flush sees this value
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	//Only the first report since the last flush pays for queueing, every later one is just the store above
+	if (bNotificationQueued.load(std::memory_order_relaxed) || bNotificationQueued.exchange(true, std::memory_order_acq_rel))
+		return;
+
+	QueuedChannels.Enqueue(AsWeak());
+	if (!bFlushTickerRegistered.exchange(true))
+	{
+		FTSTicker::GetCoreTicker().AddTicker(TEXT("OGProgressChannel"), 0.f, [](float DeltaTime)
+		{
+			FlushNotifications();
+			return true;
+		});
+	}
+}
+
+void FOGProgressChannel::FlushNotifications()
+{
+	check(IsInGameThread());
+
+	//Composites are queued while their children notify, and are drained in the same flush
+	TWeakPtr<FOGProgressChannel> WeakChannel;
+	while (QueuedChannels.Dequeue(WeakChannel))
+	{
+		if (const TSharedPtr<FOGProgressChannel> Channel = WeakChannel.Pin())
+		{
+			Channel->bNotificationQueued.store(false, std::memory_order_relaxed);
+			//Pairs with the fence in SetProgress, so a report racing this flush is either read here or queued again
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			Channel->Notify();
+		}
+	}
+}
+
+void FOGProgressChannel::Notify()
+{
+	const float CurrentProgress = GetProgress();
+	if (CurrentProgress == NotifiedProgress)
+		return;
+
+	NotifiedProgress = CurrentProgress;
+	OnProgressDelegate.Broadcast(CurrentProgress);
+}
+
+TSharedRef<FOGProgressChannel> FOGProgressChannel::MakeComposite(const TArray<TSharedRef<FOGProgressChannel>>& Children, const TArray<float>& Weights)
+{
+	check(IsInGameThread());
+	ensureAlwaysMsgf(Weights.IsEmpty() || Weights.Num() == Children.Num(), TEXT("Composite progress needs one weight per child, using equal weights"));
+	const bool bUseWeights = Weights.Num() == Children.Num();
+
+	struct FComposite
+	{
+		TArray<float> NormalizedWeights;
+		TArray<float> ChildProgress;
+		float WeightedSum = 0.f;
+	};
+
+	TSharedRef<FOGProgressChannel> Composite = MakeShared<FOGProgressChannel>();
+	TSharedRef<FComposite> State = MakeShared<FComposite>();
+	float TotalWeight = 0.f;
+	for (int32 Index = 0; Index < Children.Num(); ++Index)
+	{
+		TotalWeight += bUseWeights ? FMath::Max(0.f, Weights[Index]) : 1.f;
+	}
+	for (int32 Index = 0; Index < Children.Num(); ++Index)
+	{
+		const float Weight = bUseWeights ? FMath::Max(0.f, Weights[Index]) : 1.f;
+		State->NormalizedWeights.Add(TotalWeight > 0.f ? Weight / TotalWeight : 0.f);
+		State->ChildProgress.Add(Children[Index]->GetProgress());
+		State->WeightedSum += State->NormalizedWeights[Index] * State->ChildProgress[Index];
+	}
+	Composite->SetProgress(Children.IsEmpty() ? 1.f : State->WeightedSum);
+
+	//Each child only adjusts its own term, so a frame costs one update per child that moved rather than a full resum
+	const TWeakPtr<FOGProgressChannel> WeakComposite = Composite;
+	for (int32 Index = 0; Index < Children.Num(); ++Index)
+	{
+		Children[Index]->OnProgressDelegate.AddLambda([WeakComposite, State, Index](float ChildProgress)
+		{
+			if (const TSharedPtr<FOGProgressChannel> PinnedComposite = WeakComposite.Pin())
+			{
+				State->WeightedSum += State->NormalizedWeights[Index] * (ChildProgress - State->ChildProgress[Index]);
+				State->ChildProgress[Index] = ChildProgress;
+				PinnedComposite->SetProgress(State->WeightedSum);
+			}
+		});
+	}
+	return Composite;
+}
+
+TOGProgressFuture<void> OGAsync::FutureAll(const UObject* Context, const TArray<FOGProgressFuture>& WaitForAll, const TArray<float>& Weights)
+{
+	TArray<FOGFuture> Futures;
+	TArray<TSharedRef<FOGProgressChannel>> Channels;
+	for (const FOGProgressFuture& ProgressFuture : WaitForAll)
+	{
+		Futures.Add(ProgressFuture.Future);
+
+		//Futures without a channel of their own still count, jumping to done when they resolve
+		const TSharedRef<FOGProgressChannel> Channel = ProgressFuture.Channel.IsValid() ? ProgressFuture.Channel.ToSharedRef() : MakeShared<FOGProgressChannel>();
+		Channels.Add(Channel);
+		(void)ProgressFuture.Future->WeakThen(Context, [Channel]()
+		{
+			Channel->SetProgress(1.f);
+		});
+	}
+
+	const TOGFuture<void> AllFuture = UOGFutureUtilities::FutureAll(Context, Futures);
+	return TOGProgressFuture<void>(AllFuture, FOGProgressChannel::MakeComposite(Channels, Weights));
+}
@@ -0,0 +1,196 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+
+#include "OGStartupSubsystem.h"
+
+#include "Algo/StableSort.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "OGAsyncDispatch.h"
+#include "Tasks/Task.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOGStartup, Log, All);
+
+namespace
+{
+	float StartupFrameBudgetMs = 8.f;
+	FAutoConsoleVariableRef CVarStartupFrameBudgetMs(
+		TEXT("OGAsync.Startup.FrameBudgetMs"),
+		StartupFrameBudgetMs,
+		TEXT("How long each frame may spend starting game thread startup steps. At least one step is started per frame."));
+
+	bool bWriteStartupTimeline = false;
+	FAutoConsoleVariableRef CVarWriteStartupTimeline(
+		TEXT("OGAsync.Startup.WriteTimeline"),
+		bWriteStartupTimeline,
+		TEXT("Write the startup timeline to Saved/Profiling/OGStartupTimeline.csv when startup finishes."));
+}
+
+void UOGStartupSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	//Other subsystems register their steps during their own Initialize, so wait a tick before starting
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UOGStartupSubsystem::Tick));
+}
+
+void UOGStartupSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+	ReadyGameThreadSteps.Empty();
+
+	//Let anyone still waiting on startup know it will never finish
+	if (ReadyPromise->IsPending())
+	{
+		ReadyPromise->Throw(TEXT("Game instance shut down before startup finished"));
+	}
+	if (TimelinePromise->IsPending())
+	{
+		TimelinePromise->Throw(TEXT("Game instance shut down before startup finished"));
+	}
+
+	Super::Deinitialize();
+}
+
+void UOGStartupSubsystem::AddStep(FName Name, TFunction<TOGFuture<void>()> Step, const TArray<FName>& Dependencies)
+{
+	if (!ensureAlwaysMsgf(!bStarted, TEXT("Startup step %s was added after startup began"), *Name.ToString()))
+		return;
+
+	GameThreadSteps.Add(Name, MoveTemp(Step));
+	Graph.AddNode(Name, [this, Name]()
+	{
+		//Started from a later frame slice rather than inline, so one resolution can't cascade into a long frame
+		TSharedRef<TOGFutureState<void>> StepState = OGAsync::MakeFutureState<void>();
+		ReadyGameThreadSteps.Add(FReadyStep{Name, StepState});
+		return TOGFuture<void>(StepState);
+	}, Dependencies);
+}
+
+void UOGStartupSubsystem::AddWorkerStep(FName Name, TFunction<void()> Work, const TArray<FName>& Dependencies)
+{
+	if (!ensureAlwaysMsgf(!bStarted, TEXT("Startup step %s was added after startup began"), *Name.ToString()))
+		return;
+
+	Graph.AddNode(Name, [Work = MoveTemp(Work)]()
+	{
+		TSharedRef<TOGFutureState<void>> StepState = OGAsync::MakeFutureState<void>();
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [Work, StepState]()
+		{
+			Work();
+			OGAsync::RunOnGameThread([StepState]() { StepState->Fulfill(); });
+		});
+		return TOGFuture<void>(StepState);
+	}, Dependencies);
+}
+
+bool UOGStartupSubsystem::Tick(float DeltaTime)
+{
+	if (!bStarted)
+	{
+		StartGraph();
+	}
+
+	const double SliceEnd = FPlatformTime::Seconds() + StartupFrameBudgetMs / 1000.0;
+	while (!ReadyGameThreadSteps.IsEmpty() && ReadyPromise->IsPending())
+	{
+		const FReadyStep ReadyStep = ReadyGameThreadSteps[0];
+		ReadyGameThreadSteps.RemoveAt(0);
+		StartGameThreadStep(ReadyStep);
+
+		if (FPlatformTime::Seconds() >= SliceEnd)
+			break;
+	}
+
+	//Keep ticking until the graph has resolved one way or the other, steps still queued after a failure are never started
+	if (!ReadyPromise->IsPending())
+	{
+		ReadyGameThreadSteps.Empty();
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void UOGStartupSubsystem::StartGraph()
+{
+	bStarted = true;
+	UE_LOG(LogOGStartup, Log, TEXT("Starting %d startup steps"), Graph.Num());
+
+	Graph.Run(this)->WeakThen(this, [this](const FTimeline& Timeline)
+	{
+		OnStartupFinished(Timeline);
+	}, [this](const FString& Reason)
+	{
+		UE_LOG(LogOGStartup, Error, TEXT("Startup failed: %s"), *Reason);
+		ReadyGameThreadSteps.Empty();
+		ReadyPromise->Throw(Reason);
+		TimelinePromise->Throw(Reason);
+	});
+}
+
+void UOGStartupSubsystem::StartGameThreadStep(const FReadyStep& ReadyStep)
+{
+	GameThreadStartTimes.Add(ReadyStep.Name, FPlatformTime::Seconds());
+	const TFunction<TOGFuture<void>()>* Step = GameThreadSteps.Find(ReadyStep.Name);
+	const TOGFuture<void> StepFuture = Step && *Step ? (*Step)() : TOGFuture<void>();
+	if (!StepFuture.IsValid())
+	{
+		ReadyStep.StepState->Throw(FString::Printf(TEXT("Startup step %s did not return a valid future"), *ReadyStep.Name.ToString()));
+		return;
+	}
+
+	const TSharedPtr<TOGFutureState<void>> StepState = ReadyStep.StepState;
+	StepFuture->WeakThen(this, [StepState]()
+	{
+		StepState->Fulfill();
+	}, [StepState](const FString& Reason)
+	{
+		StepState->Throw(Reason);
+	});
+}
+
+void UOGStartupSubsystem::OnStartupFinished(const FTimeline& GraphTimeline)
+{
+	//Game thread steps may wait a few frames for a slice after their dependencies resolve, time them from when they really started
+	FTimeline Timeline = GraphTimeline;
+	for (TOGTaskGraphBuilder<>::FNodeTiming& Step : Timeline.Nodes)
+	{
+		if (const double* StartTime = GameThreadStartTimes.Find(Step.Key))
+		{
+			Step.StartTime = *StartTime;
+		}
+	}
+	Algo::StableSortBy(Timeline.Nodes, &TOGTaskGraphBuilder<>::FNodeTiming::StartTime);
+	Timeline.CriticalPathSeconds = 0.0;
+	for (const TOGTaskGraphBuilder<>::FNodeTiming& Step : Timeline.Nodes)
+	{
+		if (Timeline.CriticalPath.Contains(Step.Key))
+		{
+			Timeline.CriticalPathSeconds += Step.GetDuration();
+		}
+	}
+
+	UE_LOG(LogOGStartup, Log, TEXT("%s"), *Timeline.ToString());
+
+	if (bWriteStartupTimeline)
+	{
+		const double FirstStart = Timeline.Nodes.IsEmpty() ? 0.0 : Timeline.Nodes[0].StartTime;
+		FString Csv = TEXT("Step,StartMs,DurationMs,CriticalPath\n");
+		for (const TOGTaskGraphBuilder<>::FNodeTiming& Step : Timeline.Nodes)
+		{
+			Csv += FString::Printf(TEXT("%s,%.3f,%.3f,%d\n"), *Step.Key.ToString(), (Step.StartTime - FirstStart) * 1000.0,
+				Step.GetDuration() * 1000.0, Timeline.CriticalPath.Contains(Step.Key) ? 1 : 0);
+		}
+		const FString TimelinePath = FPaths::ProfilingDir() / TEXT("OGStartupTimeline.csv");
+		if (!FFileHelper::SaveStringToFile(Csv, *TimelinePath))
+		{
+			UE_LOG(LogOGStartup, Warning, TEXT("Failed to write startup timeline to %s"), *TimelinePath);
+		}
+	}
+
+	TimelinePromise->Fulfill(Timeline);
+	ReadyPromise->Fulfill();
+}
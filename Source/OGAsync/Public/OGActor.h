@@ -0,0 +1,157 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "OGStrand.h"
+#include <atomic>
+
+/**
+ * Owns a piece of state that is only ever touched by its own messages, one at a time, on worker threads.
+ *
+ * Messages are handled by overloads of TState::Handle. Ask returns a future of the handler's result that resolves on the
+ * game thread, Tell drops the result. Both can be called from any thread. Messages go into a lock free mailbox that is
+ * drained on the actor's strand in batches of up to MaxBatchSize, so a single activation handles a burst of messages while
+ * the state is still hot in cache, instead of paying for a task per message.
+ *
+ * Usage:
+ *	struct FScoreBoard
+ *	{
+ *		TMap<FName, int32> Scores;
+ *		void Handle(const FAddScore& Message) { Scores.FindOrAdd(Message.Player) += Message.Points; }
+ *		int32 Handle(const FGetScore& Message) { return Scores.FindRef(Message.Player); }
+ *	};
+ *
+ *	TOGActor<FScoreBoard> ScoreBoard;
+ *	ScoreBoard.Tell(FAddScore{"Player1", 10});
+ *	ScoreBoard.Ask(FGetScore{"Player1"})->WeakThen(this, [](const int32& Score) { ... });
+ *
+ * Destroying the actor waits for the mailbox batch in progress to finish. Messages still queued after it are dropped,
+ * and the futures of dropped Asks are rejected on the game thread.
+ */
+template<typename TState>
+class TOGActor : public FNoncopyable
+{
+public:
+	static constexpr int32 DefaultMaxBatchSize = 64;
+
+	template<typename... ArgTypes>
+	explicit TOGActor(ArgTypes&&... Args)
+		: State(Forward<ArgTypes>(Args)...)
+	{
+	}
+
+	~TOGActor()
+	{
+		bDestroying.store(true, std::memory_order_relaxed);
+	}
+
+	//Sends a message and resolves the returned future with TState::Handle's result on the game thread
+	template<typename MessageType>
+	auto Ask(MessageType&& Message)
+	{
+		typedef std::decay_t<MessageType> FMessage;
+		typedef std::decay_t<decltype(DeclVal<TState&>().Handle(DeclVal<FMessage&&>()))> FReply;
+
+		TSharedRef<TOGFutureState<FReply>> ReplyState = OGAsync::MakeFutureState<FReply>();
+		Enqueue([Reply = TReplyGuard<FReply>(ReplyState), Message = FMessage(Forward<MessageType>(Message))](TState& InState) mutable
+		{
+			const TSharedRef<TOGFutureState<FReply>> HandledState = Reply.Release();
+			auto Handle = [&InState, &Message]() { return InState.Handle(MoveTemp(Message)); };
+			OGAsync::Private::InvokeAndFulfillOnGameThread(HandledState, Handle);
+		});
+		return TOGFuture<FReply>(ReplyState);
+	}
+
+	//Sends a message without waiting for a reply
+	template<typename MessageType>
+	void Tell(MessageType&& Message)
+	{
+		typedef std::decay_t<MessageType> FMessage;
+		Enqueue([Message = FMessage(Forward<MessageType>(Message))](TState& InState) mutable
+		{
+			(void)InState.Handle(MoveTemp(Message));
+		});
+	}
+
+	//How many messages one activation handles before yielding its worker to other tasks
+	void SetMaxBatchSize(int32 InMaxBatchSize) { MaxBatchSize.store(FMath::Max(1, InMaxBatchSize), std::memory_order_relaxed); }
+
+	bool IsIdle() const { return !bScheduled.load(std::memory_order_acquire) && Strand.IsIdle(); }
+
+protected:
+	typedef TUniqueFunction<void(TState&)> FEnvelope;
+
+	//Rejects the reply of a message that is dropped without being handled, as ~TOGPromise does
+	template<typename FReply>
+	struct TReplyGuard
+	{
+		explicit TReplyGuard(const TSharedRef<TOGFutureState<FReply>>& InState) : State(InState) {}
+		TReplyGuard(TReplyGuard&& Other) : State(MoveTemp(Other.State)) {}
+
+		~TReplyGuard()
+		{
+			if (State.IsValid())
+			{
+				OGAsync::RunOnGameThread([State = MoveTemp(State)]()
+				{
+					if (State->IsPending())
+					{
+						State->Throw(TEXT("Actor was destroyed before it handled the message"));
+					}
+				});
+			}
+		}
+
+		TSharedRef<TOGFutureState<FReply>> Release()
+		{
+			TSharedRef<TOGFutureState<FReply>> Released = State.ToSharedRef();
+			State.Reset();
+			return Released;
+		}
+
+		TSharedPtr<TOGFutureState<FReply>> State;
+	};
+
+	void Enqueue(FEnvelope&& Envelope)
+	{
+		Mailbox.Enqueue(MoveTemp(Envelope));
+
+		//Only the first message into an idle mailbox schedules an activation, the rest ride along with it
+		if (!bScheduled.exchange(true, std::memory_order_acq_rel))
+		{
+			Strand.Post([this]() { Drain(); });
+		}
+	}
+
+	void Drain()
+	{
+		const int32 BatchSize = MaxBatchSize.load(std::memory_order_relaxed);
+		FEnvelope Envelope;
+		for (int32 Handled = 0; Handled < BatchSize && !bDestroying.load(std::memory_order_relaxed) && Mailbox.Dequeue(Envelope); ++Handled)
+		{
+			Envelope(State);
+		}
+
+		//A read-modify-write rather than a store, so the IsEmpty below can't be reordered ahead of clearing the flag. Either
+		//an Enqueue that saw the flag still set is ordered before this and its message is visible here, or it sees the flag
+		//cleared and schedules the next activation itself
+		bScheduled.exchange(false, std::memory_order_acq_rel);
+
+		//A message may have arrived after the last dequeue but before the flag was cleared, in which case nobody else scheduled it
+		if (!Mailbox.IsEmpty() && !bDestroying.load(std::memory_order_relaxed) && !bScheduled.exchange(true, std::memory_order_acq_rel))
+		{
+			Strand.Post([this]() { Drain(); });
+		}
+	}
+
+	TState State;
+	TQueue<FEnvelope, EQueueMode::Mpsc> Mailbox;
+	std::atomic<bool> bScheduled = false;
+	std::atomic<bool> bDestroying = false;
+	std::atomic<int32> MaxBatchSize = DefaultMaxBatchSize;
+
+	//Declared last so it is destroyed first, waiting for the activation in progress while the state is still alive
+	FOGStrand Strand;
+};
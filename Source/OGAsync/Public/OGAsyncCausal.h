@@ -0,0 +1,66 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGCallSite.h"
+
+//Causal chain capture can be switched on at runtime in every build but Shipping
+#ifndef OGASYNC_CAUSAL_CHAINS
+#define OGASYNC_CAUSAL_CHAINS !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * Async stack traces. While OGAsync.CausalChains is set, every future state records the program counters of the
+ * stack that made it, and continuations link to the state they continue, so a failure deep in a chain can be traced
+ * back through each Then that led to it. Capture is a stack walk per state and symbols are only looked up when a
+ * chain is printed, which keeps it cheap enough for QA builds, but it is meant for debugging sessions rather than
+ * left on. The stack is captured deep enough to get past OGAsync's own frames, which are left out when printing.
+ *
+ * With it on, every rejection that reaches a Catch queues its causal path once, at the first state with a Catch,
+ * rather than again at every continuation it is passed on to, and futures that take longer than
+ * OGAsync.CausalChains.SlowSeconds to resolve queue theirs. Queued paths are symbolicated and logged a few per frame,
+ * see OGAsync.CausalChains.ReportsPerFrame, or all at once with OGAsync.CausalChains.Flush.
+ * FOGFutureState::DescribeCausalChain returns the path on demand.
+ */
+struct FOGCausalNode
+{
+	//Enough to reach the caller through Then, WeakThen and the shared pointer plumbing in between
+	static constexpr int32 MaxFrames = 32;
+	//Frames printed per link once OGAsync's own are skipped
+	static constexpr int32 MaxCallerFrames = 8;
+
+	//Nodes hold their parents rather than states holding each other, so a chain lives as long as its newest link
+	TSharedPtr<FOGCausalNode> Parent;
+	uint64 ProgramCounters[MaxFrames];
+	int32 NumFrames = 0;
+	uint64 CreatedCycles = 0;
+	FOGCallSite CallSite;
+	//Set once the rejection that reached this state has been reported, here or at the state it was thrown from
+	bool bRejectionReported = false;
+};
+
+namespace OGAsync::Private
+{
+	extern OGASYNC_API bool bCaptureCausalChains;
+
+	OGASYNC_API TSharedPtr<FOGCausalNode> CaptureCausalNode();
+
+	//Symbolicates the chain from Node back to its root, one line per frame outside OGAsync
+	OGASYNC_API FString DescribeCausalChain(const FOGCausalNode& Node);
+
+	//Game thread. The reason of the reported rejection whose Catch callbacks are running, if any
+	extern OGASYNC_API const FString* ReportedRejection;
+	inline bool IsReportedRejection(const FString& Reason)
+	{
+		return ReportedRejection && *ReportedRejection == Reason;
+	}
+
+	//Queue the report, symbols are looked up later
+	OGASYNC_API void ReportRejection(const TSharedRef<FOGCausalNode>& Node, const FString& Reason);
+	OGASYNC_API void ReportIfSlow(const TSharedRef<FOGCausalNode>& Node);
+
+	//Logs up to MaxReports queued reports, returns how many were logged
+	OGASYNC_API int32 FlushCausalReports(int32 MaxReports = MAX_int32);
+	OGASYNC_API int32 GetNumQueuedCausalReports();
+}
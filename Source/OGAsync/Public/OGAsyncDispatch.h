@@ -0,0 +1,20 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Futures are not thread safe, so work that finishes on another thread has to hand its result back to the game thread
+ * before fulfilling a promise. RunOnGameThread collects that work from any thread into a single batch which is drained
+ * by one game thread task, so marshalling many completions costs one task graph dispatch rather than one per result.
+ *
+ * Work queued from the game thread is also deferred to the next batch, so a caller's stack is never re-entered.
+ */
+namespace OGAsync
+{
+	OGASYNC_API void RunOnGameThread(TUniqueFunction<void()>&& Work);
+
+	//Runs everything currently queued for the game thread. Must be called on the game thread.
+	OGASYNC_API void FlushGameThreadQueue();
+}
@@ -0,0 +1,74 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGCallSite.h"
+#include <atomic>
+
+/**
+ * Log-linear histogram of latencies in microseconds, in the style of HDR histograms: every power of two is split into
+ * 16 linear buckets, so any recorded value is off by at most ~6% and the whole range up to 2^40us fits in 608 counters.
+ *
+ * Futures only resolve on the game thread, so each histogram has a single writer and recording is a couple of relaxed
+ * atomic increments. The counters are atomic so a report can be merged from any thread without stopping the writer.
+ */
+class OGASYNC_API FOGLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxExponent = 40;
+	static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits + 2) * SubBucketCount;
+
+	void Record(uint64 Microseconds);
+
+	//Adds this histogram's counts into OutCounts, which must hold NumBuckets entries
+	void MergeInto(TArrayView<uint64> OutCounts) const;
+
+	uint64 GetMaxMicroseconds() const { return MaxMicroseconds.load(std::memory_order_relaxed); }
+
+	void Reset();
+
+	static int32 GetBucketIndex(uint64 Microseconds);
+
+	//The middle of the range of values that land in the bucket
+	static uint64 GetBucketValue(int32 Index);
+
+	//Value below which Percentile (0-1) of the samples fall, from counts made with MergeInto
+	static uint64 GetPercentile(TConstArrayView<uint64> Counts, double Percentile);
+
+private:
+	std::atomic<uint32> Buckets[NumBuckets] = {};
+	std::atomic<uint64> MaxMicroseconds = 0;
+};
+
+//Time from promise creation to Fulfill or Throw for one call site
+struct FOGLatencySummary
+{
+	FString CallSite;
+	uint64 Count = 0;
+	double P50Ms = 0.0;
+	double P95Ms = 0.0;
+	double P99Ms = 0.0;
+	double MaxMs = 0.0;
+};
+
+/**
+ * Promises made with an FOGCallSite record how long they took to resolve into a histogram for that site, unless
+ * OGAsync.LatencyHistograms is 0. Untagged promises cost nothing, and promises tagged with OGASYNC_CALL_SITE only take
+ * a lock the first time their site is used. `OGAsync.DumpLatency` logs the summaries.
+ */
+namespace OGAsync
+{
+	//Slowest p99 first
+	OGASYNC_API TArray<FOGLatencySummary> GetLatencySummaries();
+
+	OGASYNC_API void ResetLatencyHistograms();
+}
+
+namespace OGAsync::Private
+{
+	//Null while latency histograms are disabled. Histograms live until shutdown, so states can keep the pointer
+	OGASYNC_API FOGLatencyHistogram* FindOrAddLatencyHistogram(const FOGCallSite& CallSite);
+}
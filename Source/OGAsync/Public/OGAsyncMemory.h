@@ -0,0 +1,75 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include <atomic>
+
+//Per state type and callback memory accounting, a few relaxed atomic adds per state, in every build but Shipping
+#ifndef OGASYNC_TRACK_MEMORY
+#define OGASYNC_TRACK_MEMORY !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * Everything OGAsync allocates for futures, the states, their callback arrays and the delegates copied into them, and
+ * the work queued for the game thread, is tagged OGAsync in Low Level Memory tracking (run with -llm).
+ *
+ * `OGAsync.MemReport` breaks the memory down further: live states and their size per value type, heap memory owned by
+ * fulfilled values (for types with GetAllocatedSize, such as containers and strings) and callback storage.
+ */
+LLM_DECLARE_TAG_API(OGAsync, OGASYNC_API);
+
+#define OGASYNC_LLM_SCOPE() LLM_SCOPE_BYTAG(OGAsync)
+
+struct FOGAsyncMemoryReport
+{
+	struct FStateType
+	{
+		FString TypeName;
+		int64 NumLive = 0;
+		//Live states times the size of one state, which holds the value inline
+		int64 StateBytes = 0;
+		//Heap memory owned by fulfilled values
+		int64 PayloadBytes = 0;
+	};
+
+	//Largest first
+	TArray<FStateType> StateTypes;
+	//Callback arrays and the delegates in them, across all pending states
+	int64 CallbackBytes = 0;
+};
+
+namespace OGAsync
+{
+	OGASYNC_API FOGAsyncMemoryReport GetMemoryReport();
+}
+
+namespace OGAsync::Private
+{
+	struct FStateTypeMemory
+	{
+		FString TypeName;
+		SIZE_T StateSize = 0;
+		std::atomic<int64> NumLive = 0;
+		std::atomic<int64> PayloadBytes = 0;
+	};
+
+	//Types registered from different modules under the same name share one entry, which lives until shutdown
+	OGASYNC_API FStateTypeMemory& RegisterStateType(const ANSICHAR* TypeName, SIZE_T StateSize);
+
+	extern OGASYNC_API std::atomic<int64> CallbackBytes;
+
+	template<typename T>
+	SIZE_T GetPayloadAllocatedSize(const T& Value)
+	{
+		if constexpr (requires { Value.GetAllocatedSize(); })
+		{
+			return Value.GetAllocatedSize();
+		}
+		else
+		{
+			return 0;
+		}
+	}
+}
@@ -0,0 +1,383 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Sort.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "Tasks/Task.h"
+
+/**
+ * Asynchronous versions of ParallelFor. The work runs on UE::Tasks workers while the game thread keeps ticking, and the
+ * returned future is resolved on the game thread once every index has been processed.
+ *
+ * Each worker starts with an even slice of the index range and claims chunks from the front of it. When a worker runs
+ * out it steals the back half of another worker's remaining range, so uneven bodies still keep every worker busy.
+ * The chunk size adapts to the input: roughly eight chunks per worker, never smaller than Options.MinGrainSize.
+ *
+ * Usage:
+ *	OGAsync::ParallelForAsync(Points.Num(), [&Points](int32 Index) { Points[Index] = Project(Points[Index]); })
+ *		->WeakThen(this, [this]() { OnProjected(); });
+ *
+ * Anything the body references must stay alive until the future resolves.
+ */
+struct FOGParallelOptions
+{
+	//Smallest number of indices a worker claims at once, raise this for very cheap bodies
+	int32 MinGrainSize = 1;
+
+	//Upper bound on the number of worker tasks, 0 uses every task graph worker
+	int32 MaxWorkers = 0;
+
+	UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal;
+};
+
+namespace OGAsync::Private
+{
+	//Padded so per-worker data written in the hot loop never shares a cache line with another worker's
+	template<typename T>
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) TOGCacheLinePadded
+	{
+		T Value;
+	};
+
+	OGASYNC_API int32 GetNumParallelWorkers(const FOGParallelOptions& Options);
+
+	class OGASYNC_API FOGWorkStealingRanges
+	{
+	public:
+		FOGWorkStealingRanges(int32 Num, const FOGParallelOptions& Options);
+
+		int32 GetNumWorkers() const { return Ranges.Num(); }
+
+		//Claims the next chunk for Worker, stealing from the other workers once its own range is exhausted
+		bool Claim(int32 Worker, int32& OutBegin, int32& OutEnd);
+
+	private:
+		bool TryPopFront(int32 Worker, int32& OutBegin, int32& OutEnd);
+		bool TrySteal(int32 Worker, int32 Victim, int32& OutBegin, int32& OutEnd);
+
+		//Begin in the low 32 bits, End in the high 32 bits, so both can be updated with a single CAS
+		TArray<TOGCacheLinePadded<std::atomic<uint64>>> Ranges;
+		int32 GrainSize = 1;
+	};
+}
+
+namespace OGAsync
+{
+	template<typename BodyFunc>
+	TOGFuture<void> ParallelForAsync(int32 Num, BodyFunc&& Body, const FOGParallelOptions& Options = FOGParallelOptions())
+	{
+		TSharedRef<TOGFutureState<void>> ResultState = OGAsync::MakeFutureState<void>();
+		if (Num <= 0)
+		{
+			ResultState->Fulfill();
+			return TOGFuture<void>(ResultState);
+		}
+
+		struct FJob
+		{
+			FJob(int32 InNum, const FOGParallelOptions& InOptions, BodyFunc&& InBody, const TSharedRef<TOGFutureState<void>>& InResultState)
+				: Ranges(InNum, InOptions), Body(Forward<BodyFunc>(InBody)), ResultState(InResultState)
+			{
+				WorkersRemaining = Ranges.GetNumWorkers();
+			}
+
+			Private::FOGWorkStealingRanges Ranges;
+			std::decay_t<BodyFunc> Body;
+			std::atomic<int32> WorkersRemaining;
+			TSharedRef<TOGFutureState<void>> ResultState;
+		};
+
+		const TSharedRef<FJob> Job = MakeShared<FJob>(Num, Options, Forward<BodyFunc>(Body), ResultState);
+		for (int32 Worker = 0; Worker < Job->Ranges.GetNumWorkers(); ++Worker)
+		{
+			UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Worker]()
+			{
+				int32 Begin, End;
+				while (Job->Ranges.Claim(Worker, Begin, End))
+				{
+					for (int32 Index = Begin; Index < End; ++Index)
+					{
+						Job->Body(Index);
+					}
+				}
+
+				if (Job->WorkersRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					RunOnGameThread([ResultState = Job->ResultState]() { ResultState->Fulfill(); });
+				}
+			}, Options.Priority);
+		}
+		return TOGFuture<void>(ResultState);
+	}
+
+	/**
+	 * Maps every input on worker threads and reduces the results into a single value.
+	 * Each worker folds the items it processes into its own padded accumulator, and the accumulators are combined by the
+	 * last worker to finish. Because work is stolen between workers, Reduce must be associative and commutative.
+	 * Rejects if Inputs is empty, as there is nothing to reduce.
+	 * @param Map Invoked as Map(Input) -> Out
+	 * @param Reduce Invoked as Reduce(Out&&, Out&&) -> Out
+	 */
+	template<typename InType, typename MapFunc, typename ReduceFunc, typename OutType = std::decay_t<TInvokeResult_T<MapFunc, InType&>>>
+	TOGFuture<OutType> MapReduceAsync(TArrayView<InType> Inputs, MapFunc&& Map, ReduceFunc&& Reduce, const FOGParallelOptions& Options = FOGParallelOptions())
+	{
+		TSharedRef<TOGFutureState<OutType>> ResultState = OGAsync::MakeFutureState<OutType>();
+		if (Inputs.IsEmpty())
+		{
+			ResultState->Throw(TEXT("MapReduceAsync has no inputs to reduce"));
+			return TOGFuture<OutType>(ResultState);
+		}
+
+		struct FJob
+		{
+			FJob(TArrayView<InType> InInputs, const FOGParallelOptions& InOptions, MapFunc&& InMap, ReduceFunc&& InReduce, const TSharedRef<TOGFutureState<OutType>>& InResultState)
+				: Inputs(InInputs), Ranges(InInputs.Num(), InOptions), Map(Forward<MapFunc>(InMap)), Reduce(Forward<ReduceFunc>(InReduce)), ResultState(InResultState)
+			{
+				Accumulators.SetNum(Ranges.GetNumWorkers());
+				WorkersRemaining = Ranges.GetNumWorkers();
+			}
+
+			TArrayView<InType> Inputs;
+			Private::FOGWorkStealingRanges Ranges;
+			std::decay_t<MapFunc> Map;
+			std::decay_t<ReduceFunc> Reduce;
+			TArray<Private::TOGCacheLinePadded<TOptional<OutType>>> Accumulators;
+			std::atomic<int32> WorkersRemaining;
+			TSharedRef<TOGFutureState<OutType>> ResultState;
+		};
+
+		const TSharedRef<FJob> Job = MakeShared<FJob>(Inputs, Options, Forward<MapFunc>(Map), Forward<ReduceFunc>(Reduce), ResultState);
+		for (int32 Worker = 0; Worker < Job->Ranges.GetNumWorkers(); ++Worker)
+		{
+			UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Worker]()
+			{
+				TOptional<OutType>& Accumulator = Job->Accumulators[Worker].Value;
+				int32 Begin, End;
+				while (Job->Ranges.Claim(Worker, Begin, End))
+				{
+					for (int32 Index = Begin; Index < End; ++Index)
+					{
+						if (Accumulator.IsSet())
+						{
+							Accumulator = Job->Reduce(MoveTemp(Accumulator.GetValue()), Job->Map(Job->Inputs[Index]));
+						}
+						else
+						{
+							Accumulator.Emplace(Job->Map(Job->Inputs[Index]));
+						}
+					}
+				}
+
+				if (Job->WorkersRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+					return;
+
+				//Last worker out combines everyone's accumulators
+				TOptional<OutType> Result;
+				for (Private::TOGCacheLinePadded<TOptional<OutType>>& Partial : Job->Accumulators)
+				{
+					if (!Partial.Value.IsSet())
+						continue;
+					if (Result.IsSet())
+					{
+						Result = Job->Reduce(MoveTemp(Result.GetValue()), MoveTemp(Partial.Value.GetValue()));
+					}
+					else
+					{
+						Result = MoveTemp(Partial.Value);
+					}
+				}
+				RunOnGameThread([ResultState = Job->ResultState, Result = MoveTemp(Result.GetValue())]() mutable
+				{
+					ResultState->Fulfill(MoveTemp(Result));
+				});
+			}, Options.Priority);
+		}
+		return TOGFuture<OutType>(ResultState);
+	}
+
+	//Inputs smaller than this are sorted inline with Algo::Sort, as spinning up workers would cost more than the sort
+	constexpr int32 SortAsyncParallelThreshold = 16384;
+
+	/**
+	 * Sorts Items on worker threads with a parallel merge sort and resolves with the sorted array on the game thread.
+	 * The array is moved into the sort and moved into the resolved future, so the elements are never copied.
+	 * Chunks are sorted with Algo::Sort in parallel, then merged pairwise in rounds, each merge only waiting on the two
+	 * runs it consumes. T must be default constructible for the merge buffer, and like Algo::Sort the sort is not stable.
+	 *
+	 * Usage:
+	 *	OGAsync::SortAsync(MoveTemp(Entries), [](const FScore& A, const FScore& B) { return A.Points > B.Points; })
+	 *		->WeakThen(this, [this](const TArray<FScore>& Sorted) { ShowLeaderboard(Sorted); });
+	 */
+	template<typename T, typename PredicateType = TLess<T>>
+	TOGFuture<TArray<T>> SortAsync(TArray<T>&& Items, PredicateType Predicate = PredicateType(), const FOGParallelOptions& Options = FOGParallelOptions())
+	{
+		TSharedRef<TOGFutureState<TArray<T>>> ResultState = OGAsync::MakeFutureState<TArray<T>>();
+		const int32 Num = Items.Num();
+		const int32 NumWorkers = Private::GetNumParallelWorkers(Options);
+		if (Num < SortAsyncParallelThreshold || NumWorkers < 2)
+		{
+			Algo::Sort(Items, Predicate);
+			ResultState->Fulfill(MoveTemp(Items));
+			return TOGFuture<TArray<T>>(ResultState);
+		}
+
+		struct FJob
+		{
+			TArray<T> Items;
+			TArray<T> Scratch;
+			PredicateType Predicate;
+			TSharedRef<TOGFutureState<TArray<T>>> ResultState;
+		};
+		const TSharedRef<FJob> Job = MakeShared<FJob>(FJob{MoveTemp(Items), TArray<T>(), MoveTemp(Predicate), ResultState});
+
+		//Power of two so every merge round pairs up evenly
+		const int32 NumRuns = 1 << FMath::FloorLog2(NumWorkers);
+		TArray<int32> Bounds;
+		for (int32 Run = 0; Run <= NumRuns; ++Run)
+		{
+			Bounds.Add(static_cast<int32>(static_cast<int64>(Num) * Run / NumRuns));
+		}
+
+		//The merge buffer is only needed once the first pair of runs is sorted, so build it alongside the chunk sorts
+		const UE::Tasks::FTask ScratchTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Num]()
+		{
+			Job->Scratch.SetNum(Num);
+		}, Options.Priority);
+
+		TArray<UE::Tasks::FTask> RunTasks;
+		for (int32 Run = 0; Run < NumRuns; ++Run)
+		{
+			RunTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Begin = Bounds[Run], End = Bounds[Run + 1]]()
+			{
+				Algo::Sort(MakeArrayView(Job->Items.GetData() + Begin, End - Begin), Job->Predicate);
+			}, Options.Priority));
+		}
+
+		//Runs ping-pong between Items and Scratch each round
+		bool bRunsInScratch = false;
+		for (int32 Width = 1; RunTasks.Num() > 1; Width *= 2)
+		{
+			TArray<UE::Tasks::FTask> MergedTasks;
+			for (int32 Run = 0; Run + 1 < RunTasks.Num(); Run += 2)
+			{
+				const int32 Begin = Bounds[Run * Width];
+				const int32 Mid = Bounds[(Run + 1) * Width];
+				const int32 End = Bounds[(Run + 2) * Width];
+				MergedTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, Begin, Mid, End, bRunsInScratch]()
+				{
+					T* Src = bRunsInScratch ? Job->Scratch.GetData() : Job->Items.GetData();
+					T* Dst = bRunsInScratch ? Job->Items.GetData() : Job->Scratch.GetData();
+					int32 Left = Begin, Right = Mid, Out = Begin;
+					while (Left < Mid && Right < End)
+					{
+						Dst[Out++] = Job->Predicate(Src[Right], Src[Left]) ? MoveTemp(Src[Right++]) : MoveTemp(Src[Left++]);
+					}
+					while (Left < Mid)
+					{
+						Dst[Out++] = MoveTemp(Src[Left++]);
+					}
+					while (Right < End)
+					{
+						Dst[Out++] = MoveTemp(Src[Right++]);
+					}
+				}, UE::Tasks::Prerequisites(RunTasks[Run], RunTasks[Run + 1], ScratchTask), Options.Priority));
+			}
+			RunTasks = MoveTemp(MergedTasks);
+			bRunsInScratch = !bRunsInScratch;
+		}
+
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job, bRunsInScratch]()
+		{
+			if (bRunsInScratch)
+			{
+				Swap(Job->Items, Job->Scratch);
+			}
+			Job->Scratch.Empty();
+			RunOnGameThread([Job]()
+			{
+				Job->ResultState->Fulfill(MoveTemp(Job->Items));
+			});
+		}, UE::Tasks::Prerequisites(RunTasks[0]), Options.Priority);
+
+		return TOGFuture<TArray<T>>(ResultState);
+	}
+}
+
+template<typename T>
+template<typename Func>
+TOGFuture<void> TOGFutureState<T>::ThenForEachParallel(const UObject* Context, Func&& Body) const
+{
+	return ThenForEachParallel(Context, Forward<Func>(Body), FOGParallelOptions());
+}
+
+template<typename T>
+template<typename Func>
+TOGFuture<void> TOGFutureState<T>::ThenForEachParallel(const UObject* Context, Func&& Body, const FOGParallelOptions& Options) const
+{
+	static_assert(TIsTArray<T>::Value, "ThenForEachParallel is only available on futures of TArray");
+
+	TSharedRef<TOGFutureState<void>> NextState = OGAsync::MakeFutureState<void>();
+	TOGFuture<void> NextFuture(NextState);
+
+	//Workers read the fulfilled array straight out of this state, so keep it alive instead of copying the value
+	const TSharedRef<const TOGFutureState> Self = StaticCastSharedRef<const TOGFutureState>(this->AsShared());
+	WeakThen(Context, [Context, Self, NextState, Body = Forward<Func>(Body), Options]() mutable
+	{
+		const T* Items = &Self->GetValueSafe();
+		OGAsync::ParallelForAsync(Items->Num(), [Self, Items, Body = MoveTemp(Body)](int32 Index)
+		{
+			Body((*Items)[Index]);
+		}, Options)->WeakThen(Context, [NextState]() mutable
+		{
+			NextState->Fulfill();
+		});
+	}, [NextState](const FString& Reason) mutable
+	{
+		NextState->Throw(Reason);
+	});
+	return NextFuture;
+}
+
+template<typename T>
+template<typename Func>
+auto TOGFutureState<T>::ThenMapParallel(const UObject* Context, Func&& Map) const
+{
+	return ThenMapParallel(Context, Forward<Func>(Map), FOGParallelOptions());
+}
+
+template<typename T>
+template<typename Func>
+auto TOGFutureState<T>::ThenMapParallel(const UObject* Context, Func&& Map, const FOGParallelOptions& Options) const
+{
+	static_assert(TIsTArray<T>::Value, "ThenMapParallel is only available on futures of TArray");
+	using U = std::decay_t<TInvokeResult_T<Func, const typename T::ElementType&>>;
+
+	TSharedRef<TOGFutureState<TArray<U>>> NextState = OGAsync::MakeFutureState<TArray<U>>();
+	TOGFuture<TArray<U>> NextFuture(NextState);
+
+	const TSharedRef<const TOGFutureState> Self = StaticCastSharedRef<const TOGFutureState>(this->AsShared());
+	WeakThen(Context, [Context, Self, NextState, Map = Forward<Func>(Map), Options]() mutable
+	{
+		const T* Items = &Self->GetValueSafe();
+
+		//Every index writes only its own slot, so the workers never need to synchronise on the output
+		const TSharedRef<TArray<U>> Results = MakeShared<TArray<U>>();
+		Results->SetNum(Items->Num());
+		U* Slots = Results->GetData();
+
+		OGAsync::ParallelForAsync(Items->Num(), [Self, Items, Slots, Map = MoveTemp(Map)](int32 Index)
+		{
+			Slots[Index] = Map((*Items)[Index]);
+		}, Options)->WeakThen(Context, [NextState, Results]() mutable
+		{
+			NextState->Fulfill(MoveTemp(*Results));
+		});
+	}, [NextState](const FString& Reason) mutable
+	{
+		NextState->Throw(Reason);
+	});
+	return NextFuture;
+}
@@ -0,0 +1,61 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGCallSite.h"
+#include <atomic>
+
+//Pending states can be tracked in every build but Shipping. A state only carries a pointer to its registry node, the
+//node itself is allocated while tracking is on
+#ifndef OGASYNC_TRACK_PENDING
+#define OGASYNC_TRACK_PENDING !UE_BUILD_SHIPPING
+#endif
+
+struct FOGPendingFutureInfo
+{
+	//Empty for promises made without an FOGCallSite
+	FString CallSite;
+	double AgeSeconds = 0.0;
+	//Then and Catch callbacks waiting on the state
+	int32 NumSubscribers = 0;
+};
+
+/**
+ * Registry of futures that have not resolved yet, so promises that are never kept can be found. Tracking is off by
+ * default and only covers futures created while OGAsync.TrackPending is set. Each of those gets a node that is pushed
+ * onto the registry without a lock, the state marks it done when it resolves or dies and the game thread frees done
+ * nodes whenever it walks the registry. A watchdog warns once about every future pending for longer than
+ * OGAsync.PendingWarnSeconds, and `OGAsync.DumpPending [N] [wide]` logs the N oldest, or the N with the most
+ * subscribers.
+ */
+struct FOGPendingNode
+{
+	FOGPendingNode* Next = nullptr;
+	uint64 LinkedCycles = 0;
+	//Call site and subscribers are written by the state and read by the registry, both on the game thread
+	FOGCallSite CallSite;
+	int32 NumSubscribers = 0;
+	bool bStallReported = false;
+	//Set from whichever thread resolves or destroys the state, the state never touches the node after that
+	std::atomic<bool> bDone = false;
+};
+
+namespace OGAsync
+{
+	OGASYNC_API int32 GetNumPendingFutures();
+
+	//Game thread. Oldest first, or most subscribers first if bWidestFirst
+	OGASYNC_API TArray<FOGPendingFutureInfo> GetPendingFutures(int32 MaxCount, bool bWidestFirst = false);
+}
+
+#if OGASYNC_TRACK_PENDING
+namespace OGAsync::Private
+{
+	extern OGASYNC_API bool bTrackPending;
+
+	//Any thread
+	OGASYNC_API FOGPendingNode* LinkPendingNode();
+	OGASYNC_API void UnlinkPendingNode(FOGPendingNode* Node);
+}
+#endif
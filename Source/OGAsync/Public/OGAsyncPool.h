@@ -0,0 +1,259 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+
+template<typename T>
+class TOGAsyncPool;
+
+struct FOGAsyncPoolPolicy
+{
+	//Created up front when the pool is constructed
+	int32 InitialSize = 0;
+
+	//The most items the pool will ever create, 0 for no limit. Once reached, Acquire waits for a release
+	int32 MaxSize = 64;
+
+	//How many items to create at once when the pool runs dry below MaxSize
+	int32 GrowBy = 1;
+
+	//Released items become available again at the end of the frame, in one batch, rather than one by one
+	bool bBatchReleases = true;
+};
+
+/**
+ * A handle to an item borrowed from a TOGAsyncPool. Handles can be copied, the item goes back to the pool when the
+ * last copy is destroyed or reset. The last copy may be released from any thread, the return is marshalled to the
+ * game thread.
+ */
+template<typename T>
+struct TOGPooledHandle
+{
+	friend class TOGAsyncPool<T>;
+
+	TOGPooledHandle() {}
+
+	bool IsValid() const { return Shared.IsValid(); }
+	void Reset() { Shared.Reset(); }
+
+	T& Get() const { check(Shared.IsValid()); return Shared->Item; }
+	T& operator*() const { return Get(); }
+	T* operator->() const { return &Get(); }
+
+private:
+	struct FShared
+	{
+		FShared(T&& InItem, const TWeakPtr<TOGAsyncPool<T>>& InPool) : Item(MoveTemp(InItem)), Pool(InPool) {}
+
+		~FShared()
+		{
+			if (IsInGameThread())
+			{
+				if (const TSharedPtr<TOGAsyncPool<T>> PinnedPool = Pool.Pin())
+				{
+					PinnedPool->Release(MoveTemp(Item));
+				}
+			}
+			else
+			{
+				OGAsync::RunOnGameThread([Pool = Pool, Item = MoveTemp(Item)]() mutable
+				{
+					if (const TSharedPtr<TOGAsyncPool<T>> PinnedPool = Pool.Pin())
+					{
+						PinnedPool->Release(MoveTemp(Item));
+					}
+				});
+			}
+		}
+
+		T Item;
+		TWeakPtr<TOGAsyncPool<T>> Pool;
+	};
+
+	TOGPooledHandle(T&& Item, const TWeakPtr<TOGAsyncPool<T>>& Pool) : Shared(MakeShared<FShared>(MoveTemp(Item), Pool)) {}
+
+	TSharedPtr<FShared> Shared;
+};
+
+/**
+ * A pool of reusable items, such as projectile actors, decal components or scratch buffers, where running out means
+ * waiting rather than allocating without limit.
+ *
+ * Acquire resolves immediately while an item is free, or the pool can still grow. Otherwise callers queue up and are
+ * served in FIFO order as items are released, so peak memory is capped by MaxSize and no caller is starved.
+ * Items are passed through the Reset function as they are released. Pools are used from the game thread, create them
+ * with MakeShared since handles keep a weak reference back to their pool.
+ *
+ * A future stores its value, so the acquire future holds a copy of the handle, and so does the continuation state of any
+ * Then/WeakThen chained on it. The item only goes back to the pool once those futures are dropped as well, so don't keep
+ * the acquire future (or futures chained from it) around longer than the item is needed.
+ *
+ * Usage:
+ *	ScratchPool = MakeShared<TOGAsyncPool<TArray<uint8>>>(FOGAsyncPoolPolicy{4, 16},
+ *		[]() { TArray<uint8> Buffer; Buffer.Reserve(1 << 20); return Buffer; },
+ *		[](TArray<uint8>& Buffer) { Buffer.Reset(); });
+ *
+ *	ScratchPool->Acquire()->WeakThen(this, [this](const TOGPooledHandle<TArray<uint8>>& Buffer)
+ *	{
+ *		//Keep a copy of the handle for as long as the buffer is in use
+ *	});
+ */
+template<typename T>
+class TOGAsyncPool : public TSharedFromThis<TOGAsyncPool<T>>
+{
+	friend struct TOGPooledHandle<T>::FShared;
+
+public:
+	typedef TOGPooledHandle<T> FHandle;
+
+	TOGAsyncPool(const FOGAsyncPoolPolicy& InPolicy, TFunction<T()> InFactory, TFunction<void(T&)> InResetItem = nullptr)
+		: Policy(InPolicy), Factory(MoveTemp(InFactory)), ResetItem(MoveTemp(InResetItem))
+	{
+		Policy.GrowBy = FMath::Max(1, Policy.GrowBy);
+		Grow(Policy.InitialSize);
+	}
+
+	~TOGAsyncPool()
+	{
+		if (TickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		}
+		for (const TSharedRef<TOGFutureState<FHandle>>& Waiter : Waiters)
+		{
+			Waiter->Throw(TEXT("Pool was destroyed"));
+		}
+	}
+
+	//Resolves with a free item immediately if there is one, otherwise as soon as one is released.
+	//The returned future keeps the item borrowed until it is destroyed, see the class comment
+	TOGFuture<FHandle> Acquire()
+	{
+		check(IsInGameThread());
+		TSharedRef<TOGFutureState<FHandle>> HandleState = OGAsync::MakeFutureState<FHandle>();
+
+		FHandle Handle;
+		if (TryAcquire(Handle))
+		{
+			HandleState->Fulfill(MoveTemp(Handle));
+		}
+		else
+		{
+			Waiters.Add(HandleState);
+		}
+		return TOGFuture<FHandle>(HandleState);
+	}
+
+	//Never waits, returns false if the pool is empty and can't grow
+	bool TryAcquire(FHandle& OutHandle)
+	{
+		check(IsInGameThread());
+
+		//Anyone already waiting is first in line
+		if (!Waiters.IsEmpty())
+			return false;
+
+		if (FreeItems.IsEmpty())
+		{
+			Grow(Policy.GrowBy);
+		}
+		if (FreeItems.IsEmpty())
+			return false;
+
+		OutHandle = FHandle(FreeItems.Pop(EAllowShrinking::No), this->AsWeak());
+		return true;
+	}
+
+	//Makes released items available now instead of at the end of the frame
+	void FlushReleases()
+	{
+		TArray<T> Released = MoveTemp(PendingReleases);
+		for (T& Item : Released)
+		{
+			Recycle(MoveTemp(Item));
+		}
+	}
+
+	//Destroys free items until at most NumToKeep remain, e.g. after a spike in demand.
+	//Removes from the front, the coldest items, since Acquire takes the warmest from the back
+	void Shrink(int32 NumToKeep = 0)
+	{
+		const int32 NumToRemove = FMath::Max(0, FreeItems.Num() - NumToKeep);
+		FreeItems.RemoveAt(0, NumToRemove);
+		NumCreated -= NumToRemove;
+	}
+
+	int32 GetNumFree() const { return FreeItems.Num(); }
+	int32 GetNumCreated() const { return NumCreated; }
+	int32 GetNumInUse() const { return NumCreated - FreeItems.Num() - PendingReleases.Num(); }
+	int32 GetNumWaiting() const { return Waiters.Num(); }
+
+private:
+	void Grow(int32 Count)
+	{
+		if (!Factory)
+			return;
+
+		const int32 NumToCreate = Policy.MaxSize > 0 ? FMath::Min(Count, Policy.MaxSize - NumCreated) : Count;
+		for (int32 Index = 0; Index < NumToCreate; ++Index)
+		{
+			FreeItems.Add(Factory());
+		}
+		NumCreated += FMath::Max(0, NumToCreate);
+	}
+
+	void Release(T&& Item)
+	{
+		if (ResetItem)
+		{
+			ResetItem(Item);
+		}
+
+		if (!Policy.bBatchReleases)
+		{
+			Recycle(MoveTemp(Item));
+			return;
+		}
+
+		PendingReleases.Add(MoveTemp(Item));
+		if (!TickerHandle.IsValid())
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &TOGAsyncPool::Tick));
+		}
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		TickerHandle.Reset();
+		FlushReleases();
+		return false;
+	}
+
+	void Recycle(T&& Item)
+	{
+		if (Waiters.IsEmpty())
+		{
+			FreeItems.Add(MoveTemp(Item));
+			return;
+		}
+
+		const TSharedRef<TOGFutureState<FHandle>> Waiter = Waiters[0];
+		Waiters.RemoveAt(0);
+		Waiter->Fulfill(FHandle(MoveTemp(Item), this->AsWeak()));
+	}
+
+	FOGAsyncPoolPolicy Policy;
+	TFunction<T()> Factory;
+	TFunction<void(T&)> ResetItem;
+
+	//Taken from the back, so the most recently used and warmest item is reused first
+	TArray<T> FreeItems;
+	TArray<T> PendingReleases;
+	TArray<TSharedRef<TOGFutureState<FHandle>>> Waiters;
+	int32 NumCreated = 0;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,44 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "RenderingThread.h"
+
+/**
+ * Round trip to the render thread without polling a FRenderCommandFence.
+ * The lambda is enqueued as a render command and receives the immediate command list, whatever it returns is handed
+ * back to the game thread in the next dispatch batch and used to fulfill the returned future.
+ *
+ * Usage:
+ *	OGAsync::EnqueueRenderCommandAsync([Proxy](FRHICommandListImmediate& RHICmdList)
+ *	{
+ *		return Proxy->GetNumDrawCalls();
+ *	})->WeakThen(this, [](const int32& NumDrawCalls) {});
+ *
+ * Without a rendering thread (e.g. -nullrhi on a headless server, or in tests) the command runs inline and the future
+ * still resolves on the next game thread batch.
+ */
+namespace OGAsync
+{
+	template<typename Func, typename T = TInvokeResult_T<Func, FRHICommandListImmediate&>>
+	TOGFuture<T> EnqueueRenderCommandAsync(Func&& Lambda)
+	{
+		TSharedRef<TOGFutureState<T>> ResultState = OGAsync::MakeFutureState<T>();
+		ENQUEUE_RENDER_COMMAND(OGAsyncRenderCommand)([ResultState, Lambda = Forward<Func>(Lambda)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				Lambda(RHICmdList);
+				RunOnGameThread([ResultState]() { ResultState->Fulfill(); });
+			}
+			else
+			{
+				RunOnGameThread([ResultState, Result = Lambda(RHICmdList)]() mutable { ResultState->Fulfill(MoveTemp(Result)); });
+			}
+		});
+		return TOGFuture<T>(ResultState);
+	}
+}
@@ -0,0 +1,35 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats for the future system, shown with `stat OGAsync`. Counters are per frame, Live and Pending states are running
+ * totals. Everything here compiles out with the rest of the stats system.
+ */
+DECLARE_STATS_GROUP(TEXT("OGAsync"), STATGROUP_OGAsync, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live States"), STAT_OGAsync_LiveStates, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending States"), STAT_OGAsync_PendingStates, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("States Created"), STAT_OGAsync_StatesCreated, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("States Destroyed"), STAT_OGAsync_StatesDestroyed, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Continuations Allocated"), STAT_OGAsync_ContinuationsAllocated, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Callbacks Registered"), STAT_OGAsync_CallbacksRegistered, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Callbacks Dispatched"), STAT_OGAsync_CallbacksDispatched, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejections"), STAT_OGAsync_Rejections, STATGROUP_OGAsync, OGASYNC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch Callbacks"), STAT_OGAsync_Dispatch, STATGROUP_OGAsync, OGASYNC_API);
+
+/**
+ * Per frame throughput in the OGAsync category of CSV profiler captures, next to frame time: promises fulfilled,
+ * rejections, callbacks dispatched, work marshalled to the game thread from other threads and the largest backlog
+ * RunOnGameThread drained in the frame. Compiles out with the CSV profiler.
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(OGASYNC_API, OGAsync);
+
+//Callbacks are counted in both the stats system and CSV captures
+#define OGASYNC_COUNT_DISPATCHED(Count) \
+	INC_DWORD_STAT_BY(STAT_OGAsync_CallbacksDispatched, Count); \
+	CSV_CUSTOM_STAT(OGAsync, CallbacksDispatched, static_cast<int32>(Count), ECsvCustomStatOp::Accumulate)
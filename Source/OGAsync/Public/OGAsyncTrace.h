@@ -0,0 +1,84 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGCallSite.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+#define OGASYNC_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+/**
+ * Unreal Insights trace of the future lifecycle, on the "OGAsync" channel. Record it with -trace=default,OGAsync or
+ * `Trace.Enable OGAsync`. While the channel is off each hook is a single branch, and without trace support they
+ * compile out entirely.
+ *
+ * Events, all under the OGAsync logger, identify states by address and carry a Cycle64 timestamp:
+ *	StateCreated(State)                  Any future state, including continuations
+ *	StateDestroyed(State)                The state is gone and its address may be reused by a later StateCreated
+ *	StateCallSite(State, CallSite)       Follows StateCreated for promises made with an FOGCallSite
+ *	CallSiteSpec(CallSite, Name)         Important event, sent once per call site, naming its id
+ *	CallbackRegistered(State)            A Then or Catch was added
+ *	Resolved(State, bRejected)           Fulfill or Throw
+ *	DispatchBegin(State) / DispatchEnd   Around running the callbacks of a resolved state
+ *	ContinuationLink(Parent, Child)      Child resolves because Parent did
+ *
+ * Dispatches also show up as "OGAsync Dispatch" CPU scopes in the timing view. To render causal chains, subscribe a
+ * UE::Trace::IAnalyzer to the OGAsync logger: build a graph from ContinuationLink, walk each Resolved state back through
+ * its parents to the root made by a StateCallSite, and report time to resolve as Resolved.Cycle - StateCreated.Cycle
+ * per call site. Addresses are only unique between a StateCreated and the matching StateDestroyed, so retire a state's
+ * node when it is destroyed and start a new one at the next StateCreated for the same address.
+ */
+#if OGASYNC_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(OGAsyncChannel, OGASYNC_API);
+
+namespace OGAsync::Trace
+{
+	OGASYNC_API void OutputStateCreated(const void* State);
+	OGASYNC_API void OutputStateDestroyed(const void* State);
+	OGASYNC_API void OutputStateCallSite(const void* State, const FOGCallSite& CallSite);
+	OGASYNC_API void OutputCallbackRegistered(const void* State);
+	OGASYNC_API void OutputResolved(const void* State, bool bRejected);
+	OGASYNC_API void OutputDispatchBegin(const void* State);
+	OGASYNC_API void OutputDispatchEnd(const void* State);
+	OGASYNC_API void OutputContinuationLink(const void* Parent, const void* Child);
+
+	struct FDispatchScope
+	{
+		explicit FDispatchScope(const void* InState)
+		{
+			if (UE_TRACE_CHANNELEXPR_IS_ENABLED(OGAsyncChannel)) [[unlikely]]
+			{
+				State = InState;
+				OutputDispatchBegin(State);
+			}
+		}
+
+		~FDispatchScope()
+		{
+			if (State) [[unlikely]]
+			{
+				OutputDispatchEnd(State);
+			}
+		}
+
+	private:
+		const void* State = nullptr;
+	};
+}
+
+#define OGASYNC_TRACE(Event, ...) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(OGAsyncChannel)) [[unlikely]] { OGAsync::Trace::Output##Event(__VA_ARGS__); } } while (0)
+
+#define OGASYNC_TRACE_DISPATCH_SCOPE(State) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("OGAsync Dispatch", OGAsyncChannel); \
+	OGAsync::Trace::FDispatchScope ANONYMOUS_VARIABLE(OGAsyncDispatchScope)(State)
+
+#else
+
+#define OGASYNC_TRACE(Event, ...)
+#define OGASYNC_TRACE_DISPATCH_SCOPE(State)
+
+#endif
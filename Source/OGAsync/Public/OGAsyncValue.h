@@ -0,0 +1,242 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGFuture.h"
+
+/**
+ * Untyped node of the async value graph. Tracks dependencies, dirtiness and versions, see TOGAsyncValue.
+ */
+class OGASYNC_API FOGAsyncCell : public TSharedFromThis<FOGAsyncCell>
+{
+public:
+	virtual ~FOGAsyncCell() {}
+
+	//Only bumped when the value actually changes
+	uint64 GetVersion() const { return Version; }
+
+	//Inputs are depth 0, derived cells are one deeper than their deepest dependency
+	int32 GetDepth() const { return Depth; }
+
+	bool IsDirty() const { return bDirty; }
+
+	//Brings this cell up to date, recomputing it only if one of its dependencies changed since the last recompute
+	void EnsureUpToDate();
+
+	//Recomputes every dirty cell that has subscribers and notifies them, normally done once per frame automatically
+	static void FlushNotifications();
+
+protected:
+	void AddDependency(const TSharedRef<FOGAsyncCell>& Dependency);
+
+	//For inputs, when the value has been changed
+	void OnValueChanged();
+
+	//Returns whether the value changed
+	virtual bool Recompute() { return false; }
+
+	virtual bool HasSubscribers() const = 0;
+	virtual void NotifySubscribers() = 0;
+
+	void MarkDependentsDirty();
+	void ScheduleNotification();
+
+	TArray<TSharedRef<FOGAsyncCell>> Dependencies;
+	TArray<uint64> SeenDependencyVersions;
+	TArray<TWeakPtr<FOGAsyncCell>> Dependents;
+	uint64 Version = 0;
+	uint64 NotifiedVersion = 0;
+	int32 Depth = 0;
+	bool bDirty = false;
+	bool bNotificationScheduled = false;
+};
+
+template<typename T>
+class TOGAsyncCell : public FOGAsyncCell
+{
+	template<typename>
+	friend class TOGAsyncValue;
+
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnChanged, const T&);
+
+	const T& GetValue()
+	{
+		EnsureUpToDate();
+		return Value.GetValue();
+	}
+
+	void SetValue(T&& NewValue)
+	{
+		if (!ensureAlwaysMsgf(!Compute, TEXT("Only input values can be set, derived values are computed from their dependencies"))) [[unlikely]]
+			return;
+
+		if (StoreIfChanged(MoveTemp(NewValue)))
+		{
+			OnValueChanged();
+		}
+	}
+
+	FOnChanged OnChanged;
+
+protected:
+	bool StoreIfChanged(T&& NewValue)
+	{
+		if constexpr (TModels_V<CEqualityComparable, T>)
+		{
+			if (Value.IsSet() && Value.GetValue() == NewValue)
+				return false;
+		}
+		Value = MoveTemp(NewValue);
+		++Version;
+		return true;
+	}
+
+	virtual bool Recompute() override
+	{
+		return StoreIfChanged(Compute());
+	}
+
+	virtual bool HasSubscribers() const override { return OnChanged.IsBound(); }
+	virtual void NotifySubscribers() override { OnChanged.Broadcast(Value.GetValue()); }
+
+	TOptional<T> Value;
+	TFunction<T()> Compute;
+
+	//Bumped by every SetFromFuture, so only the latest future can set the value
+	uint32 FutureGeneration = 0;
+};
+
+/**
+ * A value computed from other values, some of which arrive asynchronously, such as a UI model built from several
+ * loaded assets, or an aggregate stat over many inputs.
+ *
+ * Input values are set directly, or from a future once it resolves. Derived values are computed from other values with
+ * OGAsync::Derive. When an input changes its dependents are only marked dirty, nothing is recomputed until the value is
+ * needed: either Get is called, or the end of frame flush brings every value that has subscribers up to date. Values only
+ * count as changed when they are no longer equal (for types with operator==), so a recompute that produces the same
+ * result stops there and nothing further down that branch is recomputed or notified. Subscribers are notified at most
+ * once per frame, however many times the inputs changed.
+ *
+ * The graph is game thread only.
+ *
+ * Usage:
+ *	TOGAsyncValue<int32> Gold = TOGAsyncValue<int32>::MakeInput(0);
+ *	TOGAsyncValue<float> Discount = TOGAsyncValue<float>::MakeInput(0.f);
+ *	Discount.SetFromFuture(LoadDiscount());
+ *	TOGAsyncValue<FText> Label = OGAsync::Derive([](const int32& InGold, const float& InDiscount)
+ *	{
+ *		return FText::AsNumber(InGold * (1.f - InDiscount));
+ *	}, Gold, Discount);
+ *	Label.Subscribe(this, [this](const FText& Text) { GoldText->SetText(Text); });
+ */
+template<typename T>
+class TOGAsyncValue
+{
+	template<typename>
+	friend class TOGAsyncValue;
+
+public:
+	typedef T Type;
+
+	TOGAsyncValue() {}
+
+	static TOGAsyncValue MakeInput(T InitialValue = T())
+	{
+		TOGAsyncValue Result;
+		Result.Cell = MakeShared<TOGAsyncCell<T>>();
+		Result.Cell->Value = MoveTemp(InitialValue);
+		return Result;
+	}
+
+	//An input that takes its value from Future once it is fulfilled
+	static TOGAsyncValue FromFuture(const TOGFuture<T>& Future, T InitialValue = T())
+	{
+		TOGAsyncValue Result = MakeInput(MoveTemp(InitialValue));
+		Result.SetFromFuture(Future);
+		return Result;
+	}
+
+	//Derived values are built with OGAsync::Derive, Compute is called with the current value of every dependency
+	template<typename Func, typename... DependencyTypes>
+	static TOGAsyncValue MakeDerived(Func&& Compute, const TOGAsyncValue<DependencyTypes>&... Dependencies)
+	{
+		static_assert(sizeof...(DependencyTypes) > 0, "Derived values need at least one dependency, use MakeInput for constants");
+
+		TOGAsyncValue Result;
+		Result.Cell = MakeShared<TOGAsyncCell<T>>();
+		(Result.Cell->AddDependency(Dependencies.Cell.ToSharedRef()), ...);
+		Result.Cell->Compute = [Compute = Forward<Func>(Compute), DependencyCells = MakeTuple(Dependencies.Cell.ToSharedRef()...)]()
+		{
+			return DependencyCells.ApplyAfter([&Compute](const auto&... Cells)
+			{
+				return Compute(Cells->GetValue()...);
+			});
+		};
+		return Result;
+	}
+
+	bool IsValid() const { return Cell.IsValid(); }
+
+	const T& Get() const { return Cell->GetValue(); }
+
+	uint64 GetVersion() const
+	{
+		Cell->EnsureUpToDate();
+		return Cell->GetVersion();
+	}
+
+	//Inputs only, dependents are marked dirty if the value changed
+	void Set(T NewValue)
+	{
+		Cell->SetValue(MoveTemp(NewValue));
+	}
+
+	//Inputs only, sets the value once Future is fulfilled unless another value was set from a future in the meantime
+	void SetFromFuture(const TOGFuture<T>& Future)
+	{
+		const uint32 Generation = ++Cell->FutureGeneration;
+		const TWeakPtr<TOGAsyncCell<T>> WeakCell = Cell;
+		Future->Then(typename TOGFutureState<T>::FThenDelegate::CreateLambda([WeakCell, Generation](const T& Value)
+		{
+			const TSharedPtr<TOGAsyncCell<T>> PinnedCell = WeakCell.Pin();
+			if (PinnedCell.IsValid() && PinnedCell->FutureGeneration == Generation)
+			{
+				PinnedCell->SetValue(T(Value));
+			}
+		}));
+	}
+
+	//Called at most once per frame, after the value has changed
+	template<typename Func>
+	FDelegateHandle Subscribe(const UObject* Context, Func&& Lambda) const
+	{
+		FDelegateHandle Handle = Cell->OnChanged.Add(typename TOGAsyncCell<T>::FOnChanged::FDelegate::CreateWeakLambda(Context, Forward<Func>(Lambda)));
+		Cell->NotifiedVersion = Cell->GetVersion();
+		if (Cell->IsDirty())
+		{
+			Cell->ScheduleNotification();
+		}
+		return Handle;
+	}
+
+	void Unsubscribe(FDelegateHandle Handle) const
+	{
+		Cell->OnChanged.Remove(Handle);
+	}
+
+private:
+	TSharedPtr<TOGAsyncCell<T>> Cell;
+};
+
+namespace OGAsync
+{
+	//Creates a value computed from Dependencies with Compute(const DependencyTypes&...)
+	template<typename Func, typename... DependencyTypes>
+	auto Derive(Func&& Compute, const TOGAsyncValue<DependencyTypes>&... Dependencies)
+	{
+		typedef std::decay_t<TInvokeResult_T<Func, const DependencyTypes&...>> T;
+		return TOGAsyncValue<T>::MakeDerived(Forward<Func>(Compute), Dependencies...);
+	}
+}
@@ -0,0 +1,51 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FOGLatencyHistogram;
+
+/**
+ * Where a promise was made, either a source location or a name. Pass one when making a promise to tag it in traces and
+ * latency histograms:
+ *	TOGPromise<FItemData> Promise(OGASYNC_CALL_SITE());
+ *	TOGPromise<FItemData> Promise(OGASYNC_NAMED_CALL_SITE("Inventory.LoadItem"));
+ *
+ * The macros make one static call site per use, which remembers its latency histogram, so only the first promise made
+ * there takes a lock to look it up. Call sites can also be constructed directly, e.g. with a name only known at runtime,
+ * but then every promise looks its histogram up again.
+ *
+ * Locations must be string literals, only the pointer is kept.
+ */
+struct FOGCallSite
+{
+	FOGCallSite() {}
+	explicit FOGCallSite(const TCHAR* InLocation, std::atomic<FOGLatencyHistogram*>* InCachedHistogram = nullptr)
+		: Location(InLocation), CachedHistogram(InCachedHistogram) {}
+	explicit FOGCallSite(FName InName, std::atomic<FOGLatencyHistogram*>* InCachedHistogram = nullptr)
+		: Name(InName), CachedHistogram(InCachedHistogram) {}
+
+	bool IsSet() const { return Location != nullptr || !Name.IsNone(); }
+
+	FString ToString() const { return Location ? FString(Location) : Name.ToString(); }
+
+	//Locations are literals so their address identifies them, names are told apart by the top bit
+	uint64 GetId() const
+	{
+		return Location ? static_cast<uint64>(reinterpret_cast<UPTRINT>(Location)) : (uint64(1) << 63) | Name.GetComparisonIndex().ToUnstableInt();
+	}
+
+	const TCHAR* Location = nullptr;
+	FName Name;
+
+	//Static storage owned by the macro that made this call site, null otherwise
+	std::atomic<FOGLatencyHistogram*>* CachedHistogram = nullptr;
+};
+
+#define OGASYNC_CALL_SITE() \
+	([]() -> const FOGCallSite& { static std::atomic<FOGLatencyHistogram*> Cache = nullptr; static const FOGCallSite Site(UE_SOURCE_LOCATION, &Cache); return Site; }())
+
+#define OGASYNC_NAMED_CALL_SITE(NameLiteral) \
+	([]() -> const FOGCallSite& { static std::atomic<FOGLatencyHistogram*> Cache = nullptr; static const FOGCallSite Site(FName(TEXT(NameLiteral)), &Cache); return Site; }())
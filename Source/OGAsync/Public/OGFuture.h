@@ -1,753 +1,1132 @@
-﻿/// Copyright Occam's Gamekit contributors 2025
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include <typeinfo>
-
-#include "OGFuture.generated.h"
-
-OGASYNC_API DECLARE_LOG_CATEGORY_EXTERN(LogOGFuture, Log, All);
-
-struct FOGFutureState;
-template<typename T>
-struct TOGFutureState;
-struct FOGFuture;
-template<typename T>
-struct TOGFuture;
-struct FOGPromise;
-template<typename T>
-struct TOGPromise;
-
-/**
- * "If you make a Promise, it's up to you to fulfill it.
- * If someone else makes you a promise, you must wait to see if they honor it in the Future."
- *
- * Futures are a convenient way to handle execution that needs to wait for some other process to finish
- * (and which may have already finished). When you have a Future, you can simply call WeakThen and pass in
- * a lambda function, and the lambda will be called when the underlying promise is fulfilled, or called
- * immediately if the promise is already fulfilled.
- * Futures cannot be created independently of promises, as they would never be completed.
- *
- * Promises are a commitment to fulfill when some process is complete. To ensure that the responsibility
- * is unambiguous, Promises cannot be copied or referenced, and if you move a Promise it will clear the
- * original. If you have a promise type, it is your responsibility to fulfill the promise. For convenience,
- * you can implicitly cast a Promise to a Future in order to pass the Future to another system or to wait for
- * the future to complete internally.
- * 
- * BasicUsage:
- *	class Foo
- *	{
- *	public:
- *		TOGFuture<int> GetFuture() {return MyPromise;}
- *
- *		void FulfillPromise(int Value) {MyPromise.Fulfill(Value);}
- * 
- *	protected:
- *		TOGPromise<int> MyPromise;
- *	};
- *
- *	class Bar : UObject
- *	{
- *		void Run(Foo* foo)
- *		{
- *			foo.GetFuture().WeakThen(this, [](const int& Result)
- *			{
- *				//Do something
- *			}
- *		}
- *	};
- * 
- * Internally, Promises and Futures are just wrappers around a shared pointer to a FutureState, which holds all
- * of the internal data and functionality that promises and futures rely on.
- */
-
-extern OGASYNC_API TArray<TSharedPtr<FOGFutureState>> ErrorStates;
-
-USTRUCT(BlueprintType)
-struct OGASYNC_API FOGFuture
-{
-	GENERATED_BODY()
-	FOGFuture() {}
-	FOGFuture(const TSharedPtr<FOGFutureState>& FutureState) : SharedState(FutureState) {}
-
-	static const FOGFuture EmptyFuture;
-
-	FOGFutureState const* operator->() const;
-	
-	//convert a generic future into a specific type, will error if the type doesn't match the underlying data
-	template<typename T>
-	operator TOGFuture<T>();
-
-	template<typename T>
-	operator const TOGFuture<T>() const;
-
-	bool IsValid() const
-	{
-		return SharedState.IsValid();
-	}
-
-protected:
-
-	template<typename T>
-	TOGFutureState<T>* GetTypedState() const;
-	
-	TSharedPtr<FOGFutureState> SharedState = nullptr;
-};
-
-template<typename T>
-struct TOGFuture : FOGFuture
-{
-	friend struct TOGPromise<T>;
-	typedef T Type;
-	typedef typename TOGFutureState<T>::FThenDelegate FThenDelegate;
-
-public:
-	TOGFuture() : FOGFuture(nullptr) {}
-	TOGFuture(const TSharedPtr<FOGFutureState>& FutureState) : FOGFuture(FutureState) {}
-
-	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
-};
-
-USTRUCT(BlueprintType)
-struct OGASYNC_API FOGPromise
-{
-	friend class UOGFutureBP;
-	
-	GENERATED_BODY()
-	FOGPromise() {}
-	FOGPromise(const TSharedPtr<FOGFutureState>& State) : SharedState(State) {}
-
-	static const FOGPromise EmptyPromise;
-
-	operator FOGFuture() const
-	{
-		return FOGFuture(SharedState);
-	}
-
-	FOGFutureState* operator->() const { return SharedState.Get(); }
-	template<typename T>
-	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
-
-	bool IsValid() const
-	{
-		return SharedState.IsValid();
-	}
-
-	//convert a generic future into a specific type, will error if the type doesn't match the underlying data
-	template<typename T>
-	operator TOGPromise<T>();
-
-	template<typename T>
-	operator const TOGPromise<T>() const;
-
-protected:
-	
-	template<typename T>
-	TOGFutureState<T>* GetTypedState() const;
-	
-	//Mutable so the copy constructor can null the src
-	mutable TSharedPtr<FOGFutureState> SharedState = nullptr;
-};
-
-template<typename T>
-struct TOGPromise : FOGPromise
-{
-public:
-	template<typename NoRawObjectPtr = T UE_REQUIRES(!std::is_convertible_v<T, UObject*>)>
-	TOGPromise() : FOGPromise(MakeShared<TOGFutureState<T>>()) {}
-	TOGPromise(const TSharedPtr<FOGFutureState>& FutureState) : FOGPromise(FutureState) {}
-	~TOGPromise();
-	
-	//I would love to delete the copy operations to enforce only one promise per future state, but USTRUCT containing a promise will not compile if copy is deleted. 
-	TOGPromise(const TOGPromise& Other) : FOGPromise(Other.SharedState)
-	{
-		UE_LOG(LogOGFuture, Warning, TEXT("Copying a promise is not advised, it is only supported because otherwise promises inside USTRUCTs won't compile."))
-	}
-	TOGPromise& operator=(const TOGPromise& Other)
-	{
-		UE_LOG(LogOGFuture, Warning, TEXT("Copying a promise is not advised, it is only supported because otherwise promises inside USTRUCTs won't compile."))
-		SharedState = Other.SharedState;
-		return *this;
-	}
-	
-	//Promises can be moved, but it clears the Other promise
-	TOGPromise(const TOGPromise&& Other) noexcept : FOGPromise(Other.SharedState)
-	{
-		Other.SharedState = nullptr;
-	}
-	TOGPromise& operator=(const TOGPromise&& Other) noexcept
-	{
-		if (this != &Other)
-		{
-			SharedState = Other.SharedState;
-			Other.SharedState = nullptr;
-		}
-		return *this;
-	}
-
-	//implicit conversion to TOGFuture
-	operator TOGFuture<T>()
-	{
-		return TOGFuture<T>(SharedState);
-	}
-
-	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
-};
-
-struct OGASYNC_API FOGFutureState
-{
-	friend struct FOGFuture;
-	friend struct FOGPromise;
-	
-	DECLARE_DELEGATE(FVoidThenDelegate);
-	DECLARE_DELEGATE_OneParam(FCatchDelegate, const FString&);
-
-	enum class EState
-	{
-		Pending,
-		Fulfilled,
-		Rejected
-	};
-	
-	FOGFutureState(){}
-	virtual ~FOGFutureState(){}
-
-public:
-	bool IsPending() const { return State == EState::Pending; }
-	bool IsFulfilled() const { return State == EState::Fulfilled; }
-	bool IsRejected() const { return State == EState::Rejected; }
-	
-	FOGFuture Then(const FVoidThenDelegate& Callback) const //intentionally hidden in children
-	{
-		return AddVoidThen(Callback);
-	}
-
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
-	FOGFuture WeakThen(const UObject* Context, Func&& Lambda) const
-	{
-		return AddVoidThen(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
-	}
-
-	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
-	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const;
-	
-	void Throw(const FString& Reason)
-	{
-		if (!ensureAlways(State == EState::Pending) && !FailureReason.IsSet()) [[unlikely]]
-			return;
-
-		FailureReason.Emplace(Reason);
-		State = EState::Rejected;
-		ExecuteCatchCallbacks();
-	}
-
-	FOGFuture Catch(const FCatchDelegate& Callback) const //intentionally hidden in children
-	{
-		return AddCatch(Callback);
-	}
-
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
-	FOGFuture WeakCatch(const UObject* Context, Func&& Lambda) const
-	{
-		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
-	}
-
-	//convenience that allows you to bind then and catch in a single call
-	template<typename ThenFunc, typename CatchFunc>
-	FOGFuture WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
-	{
-		WeakCatch(Context, CatchLambda);
-		return WeakThen(Context, ThenLambda);
-	}
-
-	virtual void ExecuteThenCallbacks() = 0;
-	void ExecuteCatchCallbacks()
-	{
-		//Value set but still pending will only happen while delegates are being called.
-		if (!ensureAlways(State == EState::Rejected && FailureReason.IsSet())) [[unlikely]]
-			return;
-
-		const FString& Reason = FailureReason.GetValue();
-		for (FCatchDelegate& Catch : CatchCallbacks)
-		{
-			(void)Catch.ExecuteIfBound(Reason);
-		}
-
-		if (ContinuationFutureState.IsValid())
-		{
-			ContinuationFutureState->Throw(Reason);
-		}
-		
-		ClearCallbacks();
-	}
-
-	virtual void ClearCallbacks()
-	{
-        VoidThenCallbacks.Empty();
-        CatchCallbacks.Empty();
-	}
-	
-	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const = 0;
-	
-protected:
-
-	virtual const std::type_info& GetInnerTypeInfo() const {return typeid(void); }
-
-	FOGFuture AddVoidThen(const FVoidThenDelegate& Callback) const
-	{
-		switch (State)
-		{
-		case EState::Pending:
-			VoidThenCallbacks.Add(Callback);
-			break;
-		case EState::Fulfilled:
-			(void)Callback.ExecuteIfBound();
-			break;
-		default:
-			//do nothing
-				break;
-		}
-
-		return LazyGetContinuation();
-	}
-
-	FOGFuture AddCatch(const FCatchDelegate& Callback) const
-	{
-		switch (State)
-		{
-		case EState::Pending:
-			CatchCallbacks.Add(Callback);
-			break;
-		case EState::Rejected:
-			(void)Callback.ExecuteIfBound(FailureReason.GetValue());
-			break;
-		default:
-			//Do nothing
-				break;
-		}
-		
-		return LazyGetContinuation();
-	}
-	
-	EState State = EState::Pending;
-	
-	TOptional<FString> FailureReason;
-
-	// Callbacks that don't need type
-	mutable TArray<FVoidThenDelegate> VoidThenCallbacks;
-	mutable TArray<FCatchDelegate> CatchCallbacks;
-	
-	mutable TSharedPtr<FOGFutureState> ContinuationFutureState;
-};
-
-//Void specialization of TOGFutureState - implement this first as TOGFutureState<void> uses it
-template<>
-struct TOGFutureState<void> : FOGFutureState
-{
-	friend struct FOGFuture;
-	friend struct TOGFuture<void>;
-	friend struct FOGPromise;
-	friend struct TOGPromise<void>;
-
-	typedef FVoidThenDelegate FThenDelegate;
-	
-	TOGFutureState(){}
-
-public:
-	
-	TOGFuture<void> Then(const FVoidThenDelegate& Callback) const //intentionally hiding parent function
-	{
-		return FOGFutureState::Then(Callback);
-	}
-
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
-	TOGFuture<void> WeakThen(const UObject* Context, Func&& Lambda) const
-	{
-		return Then(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
-	}
-
-	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
-	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
-	{
-		return FOGFutureState::WeakThen(Context, AsyncLambda);
-	}
-
-	TOGFuture<void> Catch(const FCatchDelegate& Callback) const //intentionally hiding parent function
-	{
-		return FOGFutureState::Catch(Callback);
-	}
-
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
-	TOGFuture<void> WeakCatch(const UObject* Context, Func&& Lambda) const
-	{
-		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
-	}
-
-	//convenience that allows you to bind then and catch in a single call
-	template<typename ThenFunc, typename CatchFunc>
-	TOGFuture<void> WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
-	{
-		WeakCatch(Context, CatchLambda);
-		return WeakThen(Context, ThenLambda);
-	}
-	
-	void Fulfill()
-	{
-		if(!ensureAlways(State == EState::Pending)) [[unlikely]]
-			return;
-		
-		State = EState::Fulfilled;
-		ExecuteThenCallbacks();
-	}
-
-protected:
-	TOGFuture<void> AddThen(const FVoidThenDelegate& Callback) const
-	{
-		return AddVoidThen(Callback);
-	}
-
-	// Execute all valid callbacks with the result value
-	virtual void ExecuteThenCallbacks() override
-	{
-		//Value set but still pending will only happen while delegates are being called.
-		if (!ensureAlways(State == EState::Fulfilled)) [[unlikely]]
-			return;
-
-		for (FVoidThenDelegate& VoidThen : VoidThenCallbacks)
-		{
-			(void)VoidThen.ExecuteIfBound();
-		}
-
-		if (ContinuationFutureState.IsValid())
-		{
-			static_cast<TOGFutureState<void>*>(ContinuationFutureState.Get())->Fulfill();
-		}
-		
-		ClearCallbacks();
-	}
-
-	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const override
-	{
-		if (!ContinuationFutureState.IsValid())
-		{
-			ContinuationFutureState = MakeShared<TOGFutureState>();
-		}
-		return ContinuationFutureState;
-	}
-
-	static TOGFutureState* GetErrorState()
-	{
-		for (TSharedPtr<FOGFutureState> SharedError : ErrorStates)
-		{
-			if (TOGFutureState* TypedState = static_cast<TOGFutureState*>(SharedError.Get()))
-				return TypedState;
-		}
-		const TSharedPtr<TOGFutureState> ErrorState = MakeShared<TOGFutureState>();
-		ErrorState->Throw(TEXT("Promise/Future access error, data is either invalid or the wrong type."));
-		ErrorStates.Add(ErrorState);
-		return ErrorState.Get();
-	}
-};
-
-template<typename T>
-struct TOGFutureState : FOGFutureState
-{
-	friend struct FOGFuture;
-	friend struct TOGFuture<T>;
-	friend struct FOGPromise;
-	friend struct TOGPromise<T>;
-	
-	DECLARE_DELEGATE_OneParam(FThenDelegate, const T&);
-
-	TOGFutureState(){}
-	
-public:
-	const T& GetValueSafe() const { return ResultValue.GetValue(); }
-
-	bool TryGetValue(T& OutValue) const
-	{
-		if (!IsFulfilled())
-			return false;
-		OutValue = GetValueSafe();
-		return true;
-	}
-
-	
-	TOGFuture<T> Then(const FVoidThenDelegate& Callback) const //intentionally hiding parent function
-	{
-		return FOGFutureState::Then(Callback);
-	}
-	
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
-	TOGFuture<T> WeakThen(const UObject* Context, Func&& Lambda) const
-	{
-		return Then(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
-	}
-	
-	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
-	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
-	{
-		return FOGFutureState::WeakThen(Context, AsyncLambda);
-	}
-	
-	TOGFuture<T> Then(const FThenDelegate& Callback) const //intentionally hiding parent function
-	{
-		return AddThen(Callback);
-	}
-
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const T&>>)>
-	TOGFuture<T> WeakThen(const UObject* Context, Func&& LambdaWithParam) const
-	{
-		return Then(FThenDelegate::CreateWeakLambda(Context, LambdaWithParam));
-	}
-
-	template<typename U, typename ReturnsU UE_REQUIRES(std::is_same_v<TInvokeResult_T<ReturnsU, const T&>, U>)>
-	TOGFuture<U> WeakThen(const UObject* Context, ReturnsU&& TransformLambda) const
-	{
-		TSharedRef<TOGFutureState<U>> TransformedState = MakeShared<TOGFutureState<U>>();
-		TOGFuture<U> TransformFuture(TransformedState);
-
-		WeakThen(Context, [TransformedState, TransformLambda](const T& Value) mutable
-		{
-			U TransformedValue = TransformLambda(Value);
-			TransformedState->Fulfill(TransformedValue);
-		});
-		
-		WeakCatch(Context, [TransformedState](const FString& Reason) mutable { TransformedState->Throw(Reason); });
-		return TransformFuture;
-	}
-
-	template<typename ReturnsFutureU, typename U = typename TInvokeResult_T<ReturnsFutureU, const T&>::Type UE_REQUIRES(std::is_same_v<TInvokeResult_T<ReturnsFutureU, const T&>, TOGFuture<U>>)>
-	TOGFuture<U> WeakThen(const UObject* Context, ReturnsFutureU&& AsyncTransformLambda) const
-	{
-		TSharedRef<TOGFutureState<U>> TransformNextState = MakeShared<TOGFutureState<U>>();
-		TOGFuture<U> TransformNextFuture(TransformNextState);
-		
-		WeakThen(Context, [Context, TransformNextState, AsyncTransformLambda](const T& Value) mutable
-		{
-			AsyncTransformLambda(Value)->WeakThen(Context, [TransformNextState](const U& TransformedValue) mutable
-			{
-				TransformNextState->Fulfill(TransformedValue);
-			}, [TransformNextState](const FString& Reason) mutable { TransformNextState->Throw(Reason); });
-		}, [TransformNextState](const FString& Reason) mutable { TransformNextState->Throw(Reason); });
-		return TransformNextFuture;
-	}
-
-	TOGFuture<T> Catch(const FCatchDelegate& Callback) const //intentionally hiding parent function
-	{
-		return FOGFutureState::Catch(Callback);
-	}
-	
-	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
-	TOGFuture<T> WeakCatch(const UObject* Context, Func&& Lambda) const
-	{
-		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
-	}
-
-	//convenience that allows you to bind then and catch in a single call
-	template<typename ThenFunc, typename CatchFunc>
-	TOGFuture<T> WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
-	{
-		WeakCatch(Context, CatchLambda);
-		return WeakThen(Context, ThenLambda);
-	}
-
-	void Fulfill(const T& Value)
-	{
-		if(!ensureAlways(State == EState::Pending && !ResultValue.IsSet())) [[unlikely]]
-			return;
-		
-		ResultValue.Emplace(Value);
-		State = EState::Fulfilled;
-		ExecuteThenCallbacks();
-	}
-	
-protected:
-	virtual const std::type_info& GetInnerTypeInfo() const override {return typeid(T); }
-	
-	TOGFuture<T> AddThen(const FThenDelegate& Callback) const
-	{
-		switch (State)
-		{
-		case EState::Pending:
-			ThenCallbacks.Add(Callback);
-			break;
-		case EState::Fulfilled:
-			Callback.ExecuteIfBound(ResultValue.GetValue());
-			break;
-		default:
-			//Do nothing
-			break;
-		}
-		
-		return LazyGetContinuation();
-	}
-	
-	// Execute all valid callbacks with the result value
-	virtual void ExecuteThenCallbacks() override
-	{
-		//Value set but still pending will only happen while delegates are being called.
-		if (!ensureAlways(ResultValue.IsSet() && State == EState::Fulfilled)) [[unlikely]]
-			return;
-
-		T Result = ResultValue.GetValue();
-		for (FThenDelegate& Then : ThenCallbacks)
-		{
-			Then.ExecuteIfBound(Result);
-		}
-
-		for (FVoidThenDelegate& VoidThen : VoidThenCallbacks)
-		{
-			(void)VoidThen.ExecuteIfBound();
-		}
-
-		if (ContinuationFutureState.IsValid())
-		{
-			static_cast<TOGFutureState<T>*>(ContinuationFutureState.Get())->Fulfill(Result);
-		}
-		
-		ClearCallbacks();
-	}
-
-	virtual void ClearCallbacks() override
-	{
-		ThenCallbacks.Empty();
-		FOGFutureState::ClearCallbacks();
-	}
-
-	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const override
-	{
-		if (!ContinuationFutureState.IsValid())
-		{
-			ContinuationFutureState = MakeShared<TOGFutureState>();
-		}
-		return ContinuationFutureState;
-	}
-
-	static TOGFutureState* GetErrorState()
-	{
-		for (TSharedPtr<FOGFutureState> SharedError : ErrorStates)
-		{
-			if (TOGFutureState* TypedState = static_cast<TOGFutureState*>(SharedError.Get()))
-				return TypedState;
-		}
-		const TSharedPtr<TOGFutureState> ErrorState = MakeShared<TOGFutureState>();
-		ErrorState->Throw(TEXT("Promise/Future access error, data is either invalid or the wrong type."));
-		ErrorStates.Add(ErrorState);
-		return ErrorState.Get();
-	}
-	
-private:
-	// Store the actual value once fulfilled
-	TOptional<T> ResultValue;
-	
-	// Typed callbacks
-	mutable TArray<FThenDelegate> ThenCallbacks;
-};
-
-template <typename T>
-FOGFuture::operator TOGFuture<T>()
-{
-	if (!IsValid())
-		return TOGFuture<T>(nullptr);
-	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a future to the wrong type.")))
-	{
-		return TOGFuture<T>(nullptr);
-	}
-	
-	return TOGFuture<T>(SharedState);
-}
-
-template <typename T>
-FOGFuture::operator const TOGFuture<T>() const
-{
-	if (!IsValid())
-		return TOGFuture<T>(nullptr);
-	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a future to the wrong type.")))
-	{
-		return TOGFuture<T>(nullptr);
-	}
-	
-	return TOGFuture<T>(SharedState);
-}
-
-template <typename T>
-TOGFutureState<T>* FOGFuture::GetTypedState() const
-{
-	if (!IsValid()) [[unlikely]]
-		return TOGFutureState<T>::GetErrorState();
-	if(!ensureAlwaysMsgf(typeid(T) == SharedState.Get()->GetInnerTypeInfo(), TEXT("Tried to access FutureState with the wrong type"))) [[unlikely]]
-		return TOGFutureState<T>::GetErrorState();
-	return static_cast<TOGFutureState<T>*>(SharedState.Get());
-}
-
-template <typename T>
-TOGPromise<T>::~TOGPromise()
-{
-	if (IsValid() && SharedState->IsPending())
-	{
-		SharedState->Throw(TEXT("Promise was destroyed before it was fulfilled or failed"));
-	}
-}
-
-template <typename T>
-FOGPromise::operator TOGPromise<T>()
-{
-	if (!IsValid())
-		return TOGPromise<T>(nullptr);
-	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a promise to the wrong type.")))
-	{
-		return TOGPromise<T>(nullptr);
-	}
-	return TOGPromise<T>(SharedState);
-}
-
-template <typename T>
-FOGPromise::operator const TOGPromise<T>() const
-{
-	if (!IsValid())
-		return TOGPromise<T>(nullptr);
-	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a promise to the wrong type.")))
-	{
-		return TOGPromise<T>(nullptr);
-	}
-	return TOGPromise<T>(SharedState);
-}
-
-template <typename T>
-TOGFutureState<T>* FOGPromise::GetTypedState() const
-{
-	if (!IsValid()) [[unlikely]]
-		return TOGFutureState<T>::GetErrorState();
-	if(!ensureAlwaysMsgf(typeid(T) == SharedState.Get()->GetInnerTypeInfo(), TEXT("Tried to access FutureState with the wrong type"))) [[unlikely]]
-		return TOGFutureState<T>::GetErrorState();
-	return static_cast<TOGFutureState<T>*>(SharedState.Get());
-}
-
-template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
-	TOGFuture<void> FOGFutureState::WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
-{
-	//Create a raw promise to avoid complications related to lambda capture and deleted copy constructor
-	TSharedPtr<TOGFutureState<void>> NextState = MakeShared<TOGFutureState<void>>();
-	TOGFuture<void> NextFuture(NextState);
-		
-	WeakThen(Context,
-	[Context, NextState, AsyncLambda]() mutable
-		{
-			AsyncLambda()->WeakThen(Context,
-				[NextState]() mutable
-				{
-					NextState->Fulfill();
-				},
-				[NextState](const FString& Reason) mutable
-				{
-					NextState->Throw(Reason);
-				});
-		},
-	[NextState](const FString& Reason) mutable
-	{
-		NextState->Throw(Reason);
-	});
-	return NextFuture;
-}
\ No newline at end of file
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGAsyncCausal.h"
+#include "OGAsyncMemory.h"
+#include "OGAsyncPending.h"
+#include "OGAsyncStats.h"
+#include "OGAsyncTrace.h"
+#include <atomic>
+#include <typeinfo>
+
+#include "OGFuture.generated.h"
+
+OGASYNC_API DECLARE_LOG_CATEGORY_EXTERN(LogOGFuture, Log, All);
+
+struct FOGFutureState;
+template<typename T>
+struct TOGFutureState;
+struct FOGFuture;
+template<typename T>
+struct TOGFuture;
+struct FOGPromise;
+template<typename T>
+struct TOGPromise;
+struct FOGParallelOptions;
+class FOGLatencyHistogram;
+class FOGStrand;
+
+namespace OGAsync
+{
+	//Makes a bare future state for code that resolves it directly rather than through a promise, tagged for memory tracking
+	template<typename T>
+	TSharedRef<TOGFutureState<T>> MakeFutureState();
+}
+
+/**
+ * "If you make a Promise, it's up to you to fulfill it.
+ * If someone else makes you a promise, you must wait to see if they honor it in the Future."
+ *
+ * Futures are a convenient way to handle execution that needs to wait for some other process to finish
+ * (and which may have already finished). When you have a Future, you can simply call WeakThen and pass in
+ * a lambda function, and the lambda will be called when the underlying promise is fulfilled, or called
+ * immediately if the promise is already fulfilled.
+ * Futures cannot be created independently of promises, as they would never be completed.
+ *
+ * Promises are a commitment to fulfill when some process is complete. To ensure that the responsibility
+ * is unambiguous, Promises cannot be copied or referenced, and if you move a Promise it will clear the
+ * original. If you have a promise type, it is your responsibility to fulfill the promise. For convenience,
+ * you can implicitly cast a Promise to a Future in order to pass the Future to another system or to wait for
+ * the future to complete internally.
+ * 
+ * BasicUsage:
+ *	class Foo
+ *	{
+ *	public:
+ *		TOGFuture<int> GetFuture() {return MyPromise;}
+ *
+ *		void FulfillPromise(int Value) {MyPromise.Fulfill(Value);}
+ * 
+ *	protected:
+ *		TOGPromise<int> MyPromise;
+ *	};
+ *
+ *	class Bar : UObject
+ *	{
+ *		void Run(Foo* foo)
+ *		{
+ *			foo.GetFuture().WeakThen(this, [](const int& Result)
+ *			{
+ *				//Do something
+ *			}
+ *		}
+ *	};
+ * 
+ * Internally, Promises and Futures are just wrappers around a shared pointer to a FutureState, which holds all
+ * of the internal data and functionality that promises and futures rely on.
+ */
+
+extern OGASYNC_API TArray<TSharedPtr<FOGFutureState>> ErrorStates;
+
+USTRUCT(BlueprintType)
+struct OGASYNC_API FOGFuture
+{
+	GENERATED_BODY()
+	FOGFuture() {}
+	FOGFuture(const TSharedPtr<FOGFutureState>& FutureState) : SharedState(FutureState) {}
+
+	static const FOGFuture EmptyFuture;
+
+	FOGFutureState const* operator->() const;
+	
+	//convert a generic future into a specific type, will error if the type doesn't match the underlying data
+	template<typename T>
+	operator TOGFuture<T>();
+
+	template<typename T>
+	operator const TOGFuture<T>() const;
+
+	bool IsValid() const
+	{
+		return SharedState.IsValid();
+	}
+
+protected:
+
+	template<typename T>
+	TOGFutureState<T>* GetTypedState() const;
+	
+	TSharedPtr<FOGFutureState> SharedState = nullptr;
+};
+
+template<typename T>
+struct TOGFuture : FOGFuture
+{
+	friend struct TOGPromise<T>;
+	typedef T Type;
+	typedef typename TOGFutureState<T>::FThenDelegate FThenDelegate;
+
+public:
+	TOGFuture() : FOGFuture(nullptr) {}
+	TOGFuture(const TSharedPtr<FOGFutureState>& FutureState) : FOGFuture(FutureState) {}
+
+	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
+};
+
+USTRUCT(BlueprintType)
+struct OGASYNC_API FOGPromise
+{
+	friend class UOGFutureBP;
+	
+	GENERATED_BODY()
+	FOGPromise() {}
+	FOGPromise(const TSharedPtr<FOGFutureState>& State) : SharedState(State) {}
+
+	static const FOGPromise EmptyPromise;
+
+	operator FOGFuture() const
+	{
+		return FOGFuture(SharedState);
+	}
+
+	FOGFutureState* operator->() const { return SharedState.Get(); }
+	template<typename T>
+	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
+
+	bool IsValid() const
+	{
+		return SharedState.IsValid();
+	}
+
+	//convert a generic future into a specific type, will error if the type doesn't match the underlying data
+	template<typename T>
+	operator TOGPromise<T>();
+
+	template<typename T>
+	operator const TOGPromise<T>() const;
+
+protected:
+	
+	template<typename T>
+	TOGFutureState<T>* GetTypedState() const;
+	
+	//Mutable so the copy constructor can null the src
+	mutable TSharedPtr<FOGFutureState> SharedState = nullptr;
+};
+
+template<typename T>
+struct TOGPromise : FOGPromise
+{
+public:
+	template<typename NoRawObjectPtr = T UE_REQUIRES(!std::is_convertible_v<T, UObject*>)>
+	TOGPromise() : FOGPromise(OGAsync::MakeFutureState<T>()) {}
+	TOGPromise(const TSharedPtr<FOGFutureState>& FutureState) : FOGPromise(FutureState) {}
+
+	//Tags the promise with where it was made, see FOGCallSite
+	template<typename NoRawObjectPtr = T UE_REQUIRES(!std::is_convertible_v<T, UObject*>)>
+	explicit TOGPromise(const FOGCallSite& CallSite) : FOGPromise(OGAsync::MakeFutureState<T>())
+	{
+		SharedState->SetCallSite(CallSite);
+	}
+	~TOGPromise();
+	
+	//I would love to delete the copy operations to enforce only one promise per future state, but USTRUCT containing a promise will not compile if copy is deleted. 
+	TOGPromise(const TOGPromise& Other) : FOGPromise(Other.SharedState)
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("Copying a promise is not advised, it is only supported because otherwise promises inside USTRUCTs won't compile."))
+	}
+	TOGPromise& operator=(const TOGPromise& Other)
+	{
+		UE_LOG(LogOGFuture, Warning, TEXT("Copying a promise is not advised, it is only supported because otherwise promises inside USTRUCTs won't compile."))
+		SharedState = Other.SharedState;
+		return *this;
+	}
+	
+	//Promises can be moved, but it clears the Other promise
+	TOGPromise(const TOGPromise&& Other) noexcept : FOGPromise(Other.SharedState)
+	{
+		Other.SharedState = nullptr;
+	}
+	TOGPromise& operator=(const TOGPromise&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			SharedState = Other.SharedState;
+			Other.SharedState = nullptr;
+		}
+		return *this;
+	}
+
+	//implicit conversion to TOGFuture
+	operator TOGFuture<T>()
+	{
+		return TOGFuture<T>(SharedState);
+	}
+
+	TOGFutureState<T>* operator->() const { return GetTypedState<T>(); }
+};
+
+//Shareable from this so async work can keep the state (and the value it holds) alive without copying the value
+struct OGASYNC_API FOGFutureState : public TSharedFromThis<FOGFutureState>
+{
+	friend struct FOGFuture;
+	friend struct FOGPromise;
+	
+	DECLARE_DELEGATE(FVoidThenDelegate);
+	DECLARE_DELEGATE_OneParam(FCatchDelegate, const FString&);
+
+	enum class EState
+	{
+		Pending,
+		Fulfilled,
+		Rejected
+	};
+	
+	FOGFutureState()
+	{
+		INC_DWORD_STAT(STAT_OGAsync_StatesCreated);
+		INC_DWORD_STAT(STAT_OGAsync_LiveStates);
+		INC_DWORD_STAT(STAT_OGAsync_PendingStates);
+		OGASYNC_TRACE(StateCreated, this);
+#if OGASYNC_CAUSAL_CHAINS
+		if (OGAsync::Private::bCaptureCausalChains) [[unlikely]]
+		{
+			CausalNode = OGAsync::Private::CaptureCausalNode();
+		}
+#endif
+#if OGASYNC_TRACK_PENDING
+		if (OGAsync::Private::bTrackPending) [[unlikely]]
+		{
+			PendingNode = OGAsync::Private::LinkPendingNode();
+		}
+#endif
+	}
+	virtual ~FOGFutureState()
+	{
+		OGASYNC_TRACE(StateDestroyed, this);
+		INC_DWORD_STAT(STAT_OGAsync_StatesDestroyed);
+		DEC_DWORD_STAT(STAT_OGAsync_LiveStates);
+#if STATS
+		if (State == EState::Pending)
+		{
+			DEC_DWORD_STAT(STAT_OGAsync_PendingStates);
+		}
+#endif
+#if OGASYNC_TRACK_PENDING
+		if (PendingNode) [[unlikely]]
+		{
+			OGAsync::Private::UnlinkPendingNode(PendingNode);
+		}
+#endif
+#if OGASYNC_TRACK_MEMORY
+		EmptyCallbacks(VoidThenCallbacks);
+		EmptyCallbacks(CatchCallbacks);
+#endif
+	}
+
+public:
+	bool IsPending() const { return State == EState::Pending; }
+	bool IsFulfilled() const { return State == EState::Fulfilled; }
+	bool IsRejected() const { return State == EState::Rejected; }
+
+	/**
+	 * For worker threads that have to block on a result. Returns true once the future is fulfilled or rejected, or
+	 * false if Timeout passes first. Resolved futures return straight away, pending ones park the thread until the
+	 * game thread resolves them. Blocking the game thread would deadlock, so there it asserts and returns immediately.
+	 */
+	bool Wait(FTimespan Timeout = FTimespan::MaxValue()) const;
+
+	//Tags the state with where its promise was made, for tracing and latency histograms. Call before it resolves
+	void SetCallSite(const FOGCallSite& InCallSite);
+
+	//Where this future came from and the futures it continues, empty unless OGAsync.CausalChains was set when it was made
+	FString DescribeCausalChain() const;
+	
+	FOGFuture Then(const FVoidThenDelegate& Callback) const //intentionally hidden in children
+	{
+		return AddVoidThen(Callback);
+	}
+
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
+	FOGFuture WeakThen(const UObject* Context, Func&& Lambda) const
+	{
+		return AddVoidThen(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
+	}
+
+	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
+	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const;
+	
+	void Throw(const FString& Reason)
+	{
+		if (!ensureAlways(State == EState::Pending) && !FailureReason.IsSet()) [[unlikely]]
+			return;
+
+		INC_DWORD_STAT(STAT_OGAsync_Rejections);
+		CSV_CUSTOM_STAT(OGAsync, Rejections, 1, ECsvCustomStatOp::Accumulate);
+		FailureReason.Emplace(Reason);
+#if OGASYNC_CAUSAL_CHAINS
+		if (CausalNode.IsValid() && OGAsync::Private::IsReportedRejection(Reason)) [[unlikely]]
+		{
+			CausalNode->bRejectionReported = true;
+		}
+#endif
+		SetResolvedState(EState::Rejected);
+		ExecuteCatchCallbacks();
+	}
+
+	FOGFuture Catch(const FCatchDelegate& Callback) const //intentionally hidden in children
+	{
+		return AddCatch(Callback);
+	}
+
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
+	FOGFuture WeakCatch(const UObject* Context, Func&& Lambda) const
+	{
+		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
+	}
+
+	//convenience that allows you to bind then and catch in a single call
+	template<typename ThenFunc, typename CatchFunc>
+	FOGFuture WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
+	{
+		WeakCatch(Context, CatchLambda);
+		return WeakThen(Context, ThenLambda);
+	}
+
+	virtual void ExecuteThenCallbacks() = 0;
+	void ExecuteCatchCallbacks()
+	{
+		//Value set but still pending will only happen while delegates are being called.
+		if (!ensureAlways(State == EState::Rejected && FailureReason.IsSet())) [[unlikely]]
+			return;
+
+		SCOPE_CYCLE_COUNTER(STAT_OGAsync_Dispatch);
+		OGASYNC_TRACE_DISPATCH_SCOPE(this);
+		OGASYNC_COUNT_DISPATCHED(CatchCallbacks.Num());
+
+		const FString& Reason = FailureReason.GetValue();
+#if OGASYNC_CAUSAL_CHAINS
+		TGuardValue<const FString*> ReportedGuard(OGAsync::Private::ReportedRejection, ReportRejectionOnce(!CatchCallbacks.IsEmpty()));
+#endif
+		for (FCatchDelegate& Catch : CatchCallbacks)
+		{
+			(void)Catch.ExecuteIfBound(Reason);
+		}
+
+		if (ContinuationFutureState.IsValid())
+		{
+			ContinuationFutureState->Throw(Reason);
+		}
+		
+		ClearCallbacks();
+	}
+
+	virtual void ClearCallbacks()
+	{
+		EmptyCallbacks(VoidThenCallbacks);
+		EmptyCallbacks(CatchCallbacks);
+	}
+	
+	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const = 0;
+	
+protected:
+
+	virtual const std::type_info& GetInnerTypeInfo() const {return typeid(void); }
+
+	FOGFuture AddVoidThen(const FVoidThenDelegate& Callback) const
+	{
+		INC_DWORD_STAT(STAT_OGAsync_CallbacksRegistered);
+		OGASYNC_TRACE(CallbackRegistered, this);
+		switch (State)
+		{
+		case EState::Pending:
+			NoteSubscriber();
+			AddCallback(VoidThenCallbacks, Callback);
+			break;
+		case EState::Fulfilled:
+			OGASYNC_COUNT_DISPATCHED(1);
+			(void)Callback.ExecuteIfBound();
+			break;
+		default:
+			//do nothing
+				break;
+		}
+
+		return LazyGetContinuation();
+	}
+
+	FOGFuture AddCatch(const FCatchDelegate& Callback) const
+	{
+		INC_DWORD_STAT(STAT_OGAsync_CallbacksRegistered);
+		OGASYNC_TRACE(CallbackRegistered, this);
+		switch (State)
+		{
+		case EState::Pending:
+			NoteSubscriber();
+			AddCallback(CatchCallbacks, Callback);
+			break;
+		case EState::Rejected:
+			OGASYNC_COUNT_DISPATCHED(1);
+			{
+#if OGASYNC_CAUSAL_CHAINS
+				TGuardValue<const FString*> ReportedGuard(OGAsync::Private::ReportedRejection, ReportRejectionOnce(true));
+#endif
+				(void)Callback.ExecuteIfBound(FailureReason.GetValue());
+			}
+			break;
+		default:
+			//Do nothing
+				break;
+		}
+		
+		return LazyGetContinuation();
+	}
+	
+	//The value or failure reason must be set before the state is published, a thread returning from Wait reads it right away
+	void SetResolvedState(EState NewState)
+	{
+		DEC_DWORD_STAT(STAT_OGAsync_PendingStates);
+		OGASYNC_TRACE(Resolved, this, NewState == EState::Rejected);
+		if (NewState == EState::Fulfilled)
+		{
+			CSV_CUSTOM_STAT(OGAsync, PromisesFulfilled, 1, ECsvCustomStatOp::Accumulate);
+		}
+		if (LatencyHistogram) [[unlikely]]
+		{
+			RecordLatency();
+		}
+#if OGASYNC_CAUSAL_CHAINS
+		if (CausalNode.IsValid()) [[unlikely]]
+		{
+			OGAsync::Private::ReportIfSlow(CausalNode.ToSharedRef());
+		}
+#endif
+#if OGASYNC_TRACK_PENDING
+		if (PendingNode) [[unlikely]]
+		{
+			OGAsync::Private::UnlinkPendingNode(PendingNode);
+			PendingNode = nullptr;
+		}
+#endif
+		State = NewState;
+		if (bHasWaiters) [[unlikely]]
+		{
+			WakeWaiters();
+		}
+	}
+
+	void WakeWaiters() const;
+	void RecordLatency() const;
+
+	//Callback storage goes through these so it is tagged and accounted for, see OGAsyncMemory.h
+	template<typename DelegateType>
+	static void AddCallback(TArray<DelegateType>& Callbacks, const DelegateType& Callback)
+	{
+		OGASYNC_LLM_SCOPE();
+#if OGASYNC_TRACK_MEMORY
+		const SIZE_T BytesBefore = Callbacks.GetAllocatedSize();
+		Callbacks.Add(Callback);
+		OGAsync::Private::CallbackBytes.fetch_add(Callbacks.GetAllocatedSize() - BytesBefore + Callbacks.Last().GetAllocatedSize(), std::memory_order_relaxed);
+#else
+		Callbacks.Add(Callback);
+#endif
+	}
+
+	template<typename DelegateType>
+	static void EmptyCallbacks(TArray<DelegateType>& Callbacks)
+	{
+#if OGASYNC_TRACK_MEMORY
+		SIZE_T Bytes = Callbacks.GetAllocatedSize();
+		for (const DelegateType& Callback : Callbacks)
+		{
+			Bytes += Callback.GetAllocatedSize();
+		}
+		OGAsync::Private::CallbackBytes.fetch_sub(Bytes, std::memory_order_relaxed);
+#endif
+		Callbacks.Empty();
+	}
+
+	//Links a state that resolves when this one does, for tracing and causal chains
+	void NoteContinuation(FOGFutureState* Child) const
+	{
+		OGASYNC_TRACE(ContinuationLink, this, Child);
+#if OGASYNC_CAUSAL_CHAINS
+		if (CausalNode.IsValid() && Child->CausalNode.IsValid()) [[unlikely]]
+		{
+			Child->CausalNode->Parent = CausalNode;
+		}
+#endif
+	}
+
+#if OGASYNC_CAUSAL_CHAINS
+	//A rejection is reported at the first state it reaches that has a Catch. Returns the reason while it has been
+	//reported, so the states it is thrown on from the callbacks do not report it again
+	const FString* ReportRejectionOnce(bool bCaught) const
+	{
+		if (!CausalNode.IsValid()) [[likely]]
+			return nullptr;
+
+		if (bCaught && !CausalNode->bRejectionReported)
+		{
+			CausalNode->bRejectionReported = true;
+			OGAsync::Private::ReportRejection(CausalNode.ToSharedRef(), FailureReason.GetValue());
+		}
+		return CausalNode->bRejectionReported ? &FailureReason.GetValue() : nullptr;
+	}
+#endif
+
+	void NoteSubscriber() const
+	{
+#if OGASYNC_TRACK_PENDING
+		if (PendingNode) [[unlikely]]
+		{
+			++PendingNode->NumSubscribers;
+		}
+#endif
+	}
+
+	//Atomic so Wait can check it from other threads, everything else about a future is still game thread only
+	std::atomic<EState> State = EState::Pending;
+	mutable std::atomic<bool> bHasWaiters = false;
+
+#if OGASYNC_CAUSAL_CHAINS
+	TSharedPtr<FOGCausalNode> CausalNode;
+#endif
+
+	//Only set for promises made with a call site
+	FOGLatencyHistogram* LatencyHistogram = nullptr;
+	uint64 CreatedCycles = 0;
+
+#if OGASYNC_TRACK_PENDING
+	//Only set while the state is pending and was created with tracking on, see OGAsyncPending.h
+	FOGPendingNode* PendingNode = nullptr;
+#endif
+	
+	TOptional<FString> FailureReason;
+
+	// Callbacks that don't need type
+	mutable TArray<FVoidThenDelegate> VoidThenCallbacks;
+	mutable TArray<FCatchDelegate> CatchCallbacks;
+	
+	mutable TSharedPtr<FOGFutureState> ContinuationFutureState;
+};
+
+//Void specialization of TOGFutureState - implement this first as TOGFutureState<void> uses it
+template<>
+struct TOGFutureState<void> : FOGFutureState
+{
+	friend struct FOGFuture;
+	friend struct TOGFuture<void>;
+	friend struct FOGPromise;
+	friend struct TOGPromise<void>;
+
+	typedef FVoidThenDelegate FThenDelegate;
+	
+	TOGFutureState()
+	{
+#if OGASYNC_TRACK_MEMORY
+		GetTypeMemory().NumLive.fetch_add(1, std::memory_order_relaxed);
+#endif
+	}
+
+	virtual ~TOGFutureState() override
+	{
+#if OGASYNC_TRACK_MEMORY
+		GetTypeMemory().NumLive.fetch_sub(1, std::memory_order_relaxed);
+#endif
+	}
+
+public:
+	
+	TOGFuture<void> Then(const FVoidThenDelegate& Callback) const //intentionally hiding parent function
+	{
+		return FOGFutureState::Then(Callback);
+	}
+
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
+	TOGFuture<void> WeakThen(const UObject* Context, Func&& Lambda) const
+	{
+		return Then(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
+	}
+
+	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
+	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
+	{
+		return FOGFutureState::WeakThen(Context, AsyncLambda);
+	}
+
+	/**
+	 * Defined in OGStrand.h.
+	 * Once fulfilled, runs Lambda() on the strand after everything posted to it before, and resolves the returned future
+	 * with Lambda's result on the game thread.
+	 */
+	template<typename Func>
+	auto ThenOn(FOGStrand& Strand, const UObject* Context, Func&& Lambda) const;
+
+	TOGFuture<void> Catch(const FCatchDelegate& Callback) const //intentionally hiding parent function
+	{
+		return FOGFutureState::Catch(Callback);
+	}
+
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
+	TOGFuture<void> WeakCatch(const UObject* Context, Func&& Lambda) const
+	{
+		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
+	}
+
+	//convenience that allows you to bind then and catch in a single call
+	template<typename ThenFunc, typename CatchFunc>
+	TOGFuture<void> WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
+	{
+		WeakCatch(Context, CatchLambda);
+		return WeakThen(Context, ThenLambda);
+	}
+	
+	void Fulfill()
+	{
+		if(!ensureAlways(State == EState::Pending)) [[unlikely]]
+			return;
+		
+		SetResolvedState(EState::Fulfilled);
+		ExecuteThenCallbacks();
+	}
+
+protected:
+	TOGFuture<void> AddThen(const FVoidThenDelegate& Callback) const
+	{
+		return AddVoidThen(Callback);
+	}
+
+	// Execute all valid callbacks with the result value
+	virtual void ExecuteThenCallbacks() override
+	{
+		//Value set but still pending will only happen while delegates are being called.
+		if (!ensureAlways(State == EState::Fulfilled)) [[unlikely]]
+			return;
+
+		SCOPE_CYCLE_COUNTER(STAT_OGAsync_Dispatch);
+		OGASYNC_TRACE_DISPATCH_SCOPE(this);
+		OGASYNC_COUNT_DISPATCHED(VoidThenCallbacks.Num());
+
+		for (FVoidThenDelegate& VoidThen : VoidThenCallbacks)
+		{
+			(void)VoidThen.ExecuteIfBound();
+		}
+
+		if (ContinuationFutureState.IsValid())
+		{
+			static_cast<TOGFutureState<void>*>(ContinuationFutureState.Get())->Fulfill();
+		}
+		
+		ClearCallbacks();
+	}
+
+	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const override
+	{
+		if (!ContinuationFutureState.IsValid())
+		{
+			INC_DWORD_STAT(STAT_OGAsync_ContinuationsAllocated);
+			ContinuationFutureState = OGAsync::MakeFutureState<void>();
+			NoteContinuation(ContinuationFutureState.Get());
+		}
+		return ContinuationFutureState;
+	}
+
+#if OGASYNC_TRACK_MEMORY
+	static OGAsync::Private::FStateTypeMemory& GetTypeMemory()
+	{
+		static OGAsync::Private::FStateTypeMemory& TypeMemory = OGAsync::Private::RegisterStateType("void", sizeof(TOGFutureState));
+		return TypeMemory;
+	}
+#endif
+
+	static TOGFutureState* GetErrorState()
+	{
+		for (TSharedPtr<FOGFutureState> SharedError : ErrorStates)
+		{
+			if (TOGFutureState* TypedState = static_cast<TOGFutureState*>(SharedError.Get()))
+				return TypedState;
+		}
+		const TSharedPtr<TOGFutureState> ErrorState = MakeShared<TOGFutureState>();
+		ErrorState->Throw(TEXT("Promise/Future access error, data is either invalid or the wrong type."));
+		ErrorStates.Add(ErrorState);
+		return ErrorState.Get();
+	}
+};
+
+template<typename T>
+struct TOGFutureState : FOGFutureState
+{
+	friend struct FOGFuture;
+	friend struct TOGFuture<T>;
+	friend struct FOGPromise;
+	friend struct TOGPromise<T>;
+	
+	DECLARE_DELEGATE_OneParam(FThenDelegate, const T&);
+
+	TOGFutureState()
+	{
+#if OGASYNC_TRACK_MEMORY
+		GetTypeMemory().NumLive.fetch_add(1, std::memory_order_relaxed);
+#endif
+	}
+
+	virtual ~TOGFutureState() override
+	{
+#if OGASYNC_TRACK_MEMORY
+		GetTypeMemory().NumLive.fetch_sub(1, std::memory_order_relaxed);
+		if (ResultValue.IsSet())
+		{
+			GetTypeMemory().PayloadBytes.fetch_sub(OGAsync::Private::GetPayloadAllocatedSize(ResultValue.GetValue()), std::memory_order_relaxed);
+		}
+		EmptyCallbacks(ThenCallbacks);
+#endif
+	}
+	
+public:
+	const T& GetValueSafe() const { return GetResultValue().GetValue(); }
+
+	//Blocks like Wait, returns the value if the future was fulfilled within Timeout, or nullptr if it was rejected or timed out
+	const T* Get(FTimespan Timeout = FTimespan::MaxValue()) const
+	{
+		return Wait(Timeout) && IsFulfilled() ? &GetResultValue().GetValue() : nullptr;
+	}
+
+	bool TryGetValue(T& OutValue) const
+	{
+		if (!IsFulfilled())
+			return false;
+		OutValue = GetValueSafe();
+		return true;
+	}
+
+	
+	TOGFuture<T> Then(const FVoidThenDelegate& Callback) const //intentionally hiding parent function
+	{
+		return FOGFutureState::Then(Callback);
+	}
+	
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func>>)>
+	TOGFuture<T> WeakThen(const UObject* Context, Func&& Lambda) const
+	{
+		return Then(FVoidThenDelegate::CreateWeakLambda(Context, Lambda));
+	}
+	
+	template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
+	TOGFuture<void> WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
+	{
+		return FOGFutureState::WeakThen(Context, AsyncLambda);
+	}
+	
+	TOGFuture<T> Then(const FThenDelegate& Callback) const //intentionally hiding parent function
+	{
+		return AddThen(Callback);
+	}
+
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const T&>>)>
+	TOGFuture<T> WeakThen(const UObject* Context, Func&& LambdaWithParam) const
+	{
+		return Then(FThenDelegate::CreateWeakLambda(Context, LambdaWithParam));
+	}
+
+	template<typename U, typename ReturnsU UE_REQUIRES(std::is_same_v<TInvokeResult_T<ReturnsU, const T&>, U>)>
+	TOGFuture<U> WeakThen(const UObject* Context, ReturnsU&& TransformLambda) const
+	{
+		TSharedRef<TOGFutureState<U>> TransformedState = OGAsync::MakeFutureState<U>();
+		TOGFuture<U> TransformFuture(TransformedState);
+		NoteContinuation(&TransformedState.Get());
+
+		WeakThen(Context, [TransformedState, TransformLambda](const T& Value) mutable
+		{
+			U TransformedValue = TransformLambda(Value);
+			TransformedState->Fulfill(TransformedValue);
+		});
+		
+		WeakCatch(Context, [TransformedState](const FString& Reason) mutable { TransformedState->Throw(Reason); });
+		return TransformFuture;
+	}
+
+	template<typename ReturnsFutureU, typename U = typename TInvokeResult_T<ReturnsFutureU, const T&>::Type UE_REQUIRES(std::is_same_v<TInvokeResult_T<ReturnsFutureU, const T&>, TOGFuture<U>>)>
+	TOGFuture<U> WeakThen(const UObject* Context, ReturnsFutureU&& AsyncTransformLambda) const
+	{
+		TSharedRef<TOGFutureState<U>> TransformNextState = OGAsync::MakeFutureState<U>();
+		TOGFuture<U> TransformNextFuture(TransformNextState);
+		NoteContinuation(&TransformNextState.Get());
+		
+		WeakThen(Context, [Context, TransformNextState, AsyncTransformLambda](const T& Value) mutable
+		{
+			AsyncTransformLambda(Value)->WeakThen(Context, [TransformNextState](const U& TransformedValue) mutable
+			{
+				TransformNextState->Fulfill(TransformedValue);
+			}, [TransformNextState](const FString& Reason) mutable { TransformNextState->Throw(Reason); });
+		}, [TransformNextState](const FString& Reason) mutable { TransformNextState->Throw(Reason); });
+		return TransformNextFuture;
+	}
+
+	/**
+	 * Array futures only, defined in OGAsyncParallel.h.
+	 * Once fulfilled, runs Body(const ElementType&) for every element on worker threads, reading the array in place.
+	 * The returned future resolves on the game thread after every element has been processed.
+	 */
+	template<typename Func>
+	TOGFuture<void> ThenForEachParallel(const UObject* Context, Func&& Body) const;
+	template<typename Func>
+	TOGFuture<void> ThenForEachParallel(const UObject* Context, Func&& Body, const FOGParallelOptions& Options) const;
+
+	/**
+	 * Array futures only, defined in OGAsyncParallel.h.
+	 * Once fulfilled, maps every element on worker threads with Map(const ElementType&) -> U, writing each result into a
+	 * preallocated slot of the output array, and resolves with a TOGFuture<TArray<U>> on the game thread.
+	 * U must be default constructible.
+	 */
+	template<typename Func>
+	auto ThenMapParallel(const UObject* Context, Func&& Map) const;
+	template<typename Func>
+	auto ThenMapParallel(const UObject* Context, Func&& Map, const FOGParallelOptions& Options) const;
+
+	/**
+	 * Defined in OGStrand.h.
+	 * Once fulfilled, runs Lambda(const T&) on the strand after everything posted to it before, reading the value in
+	 * place, and resolves the returned future with Lambda's result on the game thread.
+	 */
+	template<typename Func>
+	auto ThenOn(FOGStrand& Strand, const UObject* Context, Func&& Lambda) const;
+
+	TOGFuture<T> Catch(const FCatchDelegate& Callback) const //intentionally hiding parent function
+	{
+		return FOGFutureState::Catch(Callback);
+	}
+	
+	template<typename Func UE_REQUIRES(std::is_void_v<TInvokeResult_T<Func, const FString&>>)>
+	TOGFuture<T> WeakCatch(const UObject* Context, Func&& Lambda) const
+	{
+		return Catch(FCatchDelegate::CreateWeakLambda(Context, Lambda));
+	}
+
+	//convenience that allows you to bind then and catch in a single call
+	template<typename ThenFunc, typename CatchFunc>
+	TOGFuture<T> WeakThen(const UObject* Context, ThenFunc&& ThenLambda, CatchFunc&& CatchLambda) const
+	{
+		WeakCatch(Context, CatchLambda);
+		return WeakThen(Context, ThenLambda);
+	}
+
+	void Fulfill(const T& Value)
+	{
+		if(!ensureAlways(State == EState::Pending && !ResultValue.IsSet())) [[unlikely]]
+			return;
+		
+		ResultValue.Emplace(Value);
+		TrackPayload();
+		SetResolvedState(EState::Fulfilled);
+		ExecuteThenCallbacks();
+	}
+
+	//Fulfill by moving the value in, for results handed over from other threads or large containers
+	void Fulfill(T&& Value)
+	{
+		if(!ensureAlways(State == EState::Pending && !ResultValue.IsSet())) [[unlikely]]
+			return;
+
+		ResultValue.Emplace(MoveTemp(Value));
+		TrackPayload();
+		SetResolvedState(EState::Fulfilled);
+		ExecuteThenCallbacks();
+	}
+
+protected:
+	virtual const std::type_info& GetInnerTypeInfo() const override {return typeid(T); }
+	
+	TOGFuture<T> AddThen(const FThenDelegate& Callback) const
+	{
+		INC_DWORD_STAT(STAT_OGAsync_CallbacksRegistered);
+		OGASYNC_TRACE(CallbackRegistered, this);
+		switch (State)
+		{
+		case EState::Pending:
+			NoteSubscriber();
+			AddCallback(ThenCallbacks, Callback);
+			break;
+		case EState::Fulfilled:
+			OGASYNC_COUNT_DISPATCHED(1);
+			Callback.ExecuteIfBound(GetResultValue().GetValue());
+			break;
+		default:
+			//Do nothing
+			break;
+		}
+		
+		return LazyGetContinuation();
+	}
+	
+	// Execute all valid callbacks with the result value
+	virtual void ExecuteThenCallbacks() override
+	{
+		//Value set but still pending will only happen while delegates are being called.
+		if (!ensureAlways(GetResultValue().IsSet() && State == EState::Fulfilled)) [[unlikely]]
+			return;
+
+		SCOPE_CYCLE_COUNTER(STAT_OGAsync_Dispatch);
+		OGASYNC_TRACE_DISPATCH_SCOPE(this);
+		OGASYNC_COUNT_DISPATCHED(ThenCallbacks.Num() + VoidThenCallbacks.Num());
+
+		//The value is never modified once set, so hand out references rather than copying it for dispatch
+		const T& Result = GetResultValue().GetValue();
+		for (FThenDelegate& Then : ThenCallbacks)
+		{
+			Then.ExecuteIfBound(Result);
+		}
+
+		for (FVoidThenDelegate& VoidThen : VoidThenCallbacks)
+		{
+			(void)VoidThen.ExecuteIfBound();
+		}
+
+		//The continuation reads the value from the state that holds it rather than getting a copy. It is handed over, a
+		//resolved state is its own continuation from here on, so the continuation holding this state is not a cycle
+		if (ContinuationFutureState.IsValid())
+		{
+			const TSharedPtr<FOGFutureState> Continuation = MoveTemp(ContinuationFutureState);
+			static_cast<TOGFutureState<T>*>(Continuation.Get())->FulfillShared(ValueSource.IsValid() ? ValueSource.ToSharedRef() : StaticCastSharedRef<const TOGFutureState>(AsShared()));
+		}
+		
+		ClearCallbacks();
+	}
+
+	void FulfillShared(const TSharedRef<const TOGFutureState>& InValueSource)
+	{
+		if(!ensureAlways(State == EState::Pending && !ResultValue.IsSet())) [[unlikely]]
+			return;
+
+		ValueSource = InValueSource;
+		SetResolvedState(EState::Fulfilled);
+		ExecuteThenCallbacks();
+	}
+
+	const TOptional<T>& GetResultValue() const { return ValueSource.IsValid() ? ValueSource->ResultValue : ResultValue; }
+
+	virtual void ClearCallbacks() override
+	{
+		EmptyCallbacks(ThenCallbacks);
+		FOGFutureState::ClearCallbacks();
+	}
+
+	virtual TSharedPtr<FOGFutureState> LazyGetContinuation() const override
+	{
+		//A resolved state already is what its continuation would resolve to
+		if (!IsPending())
+			return ConstCastSharedRef<FOGFutureState>(AsShared());
+
+		if (!ContinuationFutureState.IsValid())
+		{
+			INC_DWORD_STAT(STAT_OGAsync_ContinuationsAllocated);
+			ContinuationFutureState = OGAsync::MakeFutureState<T>();
+			NoteContinuation(ContinuationFutureState.Get());
+		}
+		return ContinuationFutureState;
+	}
+
+#if OGASYNC_TRACK_MEMORY
+	static OGAsync::Private::FStateTypeMemory& GetTypeMemory()
+	{
+		static OGAsync::Private::FStateTypeMemory& TypeMemory = OGAsync::Private::RegisterStateType(typeid(T).name(), sizeof(TOGFutureState));
+		return TypeMemory;
+	}
+#endif
+
+	void TrackPayload() const
+	{
+#if OGASYNC_TRACK_MEMORY
+		GetTypeMemory().PayloadBytes.fetch_add(OGAsync::Private::GetPayloadAllocatedSize(ResultValue.GetValue()), std::memory_order_relaxed);
+#endif
+	}
+
+	static TOGFutureState* GetErrorState()
+	{
+		for (TSharedPtr<FOGFutureState> SharedError : ErrorStates)
+		{
+			if (TOGFutureState* TypedState = static_cast<TOGFutureState*>(SharedError.Get()))
+				return TypedState;
+		}
+		const TSharedPtr<TOGFutureState> ErrorState = MakeShared<TOGFutureState>();
+		ErrorState->Throw(TEXT("Promise/Future access error, data is either invalid or the wrong type."));
+		ErrorStates.Add(ErrorState);
+		return ErrorState.Get();
+	}
+	
+private:
+	// Store the actual value once fulfilled
+	TOptional<T> ResultValue;
+
+	//Set instead of ResultValue on continuations, which share the value of the state they continue
+	TSharedPtr<const TOGFutureState> ValueSource;
+	
+	// Typed callbacks
+	mutable TArray<FThenDelegate> ThenCallbacks;
+};
+
+template <typename T>
+FOGFuture::operator TOGFuture<T>()
+{
+	if (!IsValid())
+		return TOGFuture<T>(nullptr);
+	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a future to the wrong type.")))
+	{
+		return TOGFuture<T>(nullptr);
+	}
+	
+	return TOGFuture<T>(SharedState);
+}
+
+template <typename T>
+FOGFuture::operator const TOGFuture<T>() const
+{
+	if (!IsValid())
+		return TOGFuture<T>(nullptr);
+	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a future to the wrong type.")))
+	{
+		return TOGFuture<T>(nullptr);
+	}
+	
+	return TOGFuture<T>(SharedState);
+}
+
+template <typename T>
+TOGFutureState<T>* FOGFuture::GetTypedState() const
+{
+	if (!IsValid()) [[unlikely]]
+		return TOGFutureState<T>::GetErrorState();
+	if(!ensureAlwaysMsgf(typeid(T) == SharedState.Get()->GetInnerTypeInfo(), TEXT("Tried to access FutureState with the wrong type"))) [[unlikely]]
+		return TOGFutureState<T>::GetErrorState();
+	return static_cast<TOGFutureState<T>*>(SharedState.Get());
+}
+
+template <typename T>
+TOGPromise<T>::~TOGPromise()
+{
+	if (IsValid() && SharedState->IsPending())
+	{
+		SharedState->Throw(TEXT("Promise was destroyed before it was fulfilled or failed"));
+	}
+}
+
+template <typename T>
+FOGPromise::operator TOGPromise<T>()
+{
+	if (!IsValid())
+		return TOGPromise<T>(nullptr);
+	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a promise to the wrong type.")))
+	{
+		return TOGPromise<T>(nullptr);
+	}
+	return TOGPromise<T>(SharedState);
+}
+
+template <typename T>
+FOGPromise::operator const TOGPromise<T>() const
+{
+	if (!IsValid())
+		return TOGPromise<T>(nullptr);
+	if (!ensureAlwaysMsgf(GetTypedState<T>(), TEXT("Trying to type a promise to the wrong type.")))
+	{
+		return TOGPromise<T>(nullptr);
+	}
+	return TOGPromise<T>(SharedState);
+}
+
+template <typename T>
+TOGFutureState<T>* FOGPromise::GetTypedState() const
+{
+	if (!IsValid()) [[unlikely]]
+		return TOGFutureState<T>::GetErrorState();
+	if(!ensureAlwaysMsgf(typeid(T) == SharedState.Get()->GetInnerTypeInfo(), TEXT("Tried to access FutureState with the wrong type"))) [[unlikely]]
+		return TOGFutureState<T>::GetErrorState();
+	return static_cast<TOGFutureState<T>*>(SharedState.Get());
+}
+
+template<typename ReturnsFuture UE_REQUIRES(std::is_convertible_v<TInvokeResult_T<ReturnsFuture>,FOGFuture>)>
+	TOGFuture<void> FOGFutureState::WeakThen(const UObject* Context, ReturnsFuture&& AsyncLambda) const
+{
+	//Create a raw promise to avoid complications related to lambda capture and deleted copy constructor
+	TSharedPtr<TOGFutureState<void>> NextState = OGAsync::MakeFutureState<void>();
+	TOGFuture<void> NextFuture(NextState);
+	NoteContinuation(NextState.Get());
+		
+	WeakThen(Context,
+	[Context, NextState, AsyncLambda]() mutable
+		{
+			AsyncLambda()->WeakThen(Context,
+				[NextState]() mutable
+				{
+					NextState->Fulfill();
+				},
+				[NextState](const FString& Reason) mutable
+				{
+					NextState->Throw(Reason);
+				});
+		},
+	[NextState](const FString& Reason) mutable
+	{
+		NextState->Throw(Reason);
+	});
+	return NextFuture;
+}
+
+template<typename T>
+TSharedRef<TOGFutureState<T>> OGAsync::MakeFutureState()
+{
+	OGASYNC_LLM_SCOPE();
+	return MakeShared<TOGFutureState<T>>();
+}
@@ -0,0 +1,115 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "Tasks/Task.h"
+
+/**
+ * Adapters between TOGFuture and the engine's TFuture and UE::Tasks::TTask, in both directions. None of them poll or
+ * block: each hooks a continuation onto the source and resolves the target from it. Results are moved across, never
+ * copied, except ToTask which copies the value once into the task since the future keeps its own.
+ *
+ * Usage:
+ *	OGAsync::ToOGFuture(Async(EAsyncExecution::ThreadPool, [](){ return LoadBlob(); }))->WeakThen(this, [](const FBlob& Blob) { ... });
+ *	UE::Tasks::TTask<TOptional<FItemData>> Task = OGAsync::ToTask(LoadItemFuture);
+ */
+namespace OGAsync
+{
+	/**
+	 * Resolves on the game thread once Future completes. The engine future is consumed, its value moved into ours.
+	 * Invalid futures reject straight away. May be called from any thread, but the result is used on the game thread.
+	 */
+	template<typename T>
+	TOGFuture<T> ToOGFuture(TFuture<T>&& Future)
+	{
+		TSharedRef<TOGFutureState<T>> ResultState = OGAsync::MakeFutureState<T>();
+		if (!ensureAlwaysMsgf(Future.IsValid(), TEXT("Converting an invalid TFuture"))) [[unlikely]]
+		{
+			OGAsync::RunOnGameThread([ResultState]() { ResultState->Throw(TEXT("Converted an invalid TFuture")); });
+			return TOGFuture<T>(ResultState);
+		}
+
+		//Runs on whichever thread completes the engine promise
+		(void)Future.Then([ResultState](TFuture<T> Completed)
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				Completed.Get();
+				OGAsync::RunOnGameThread([ResultState]() { ResultState->Fulfill(); });
+			}
+			else
+			{
+				OGAsync::RunOnGameThread([ResultState, Value = Completed.Consume()]() mutable { ResultState->Fulfill(MoveTemp(Value)); });
+			}
+		});
+		return TOGFuture<T>(ResultState);
+	}
+
+	/**
+	 * Resolves on the game thread once Task completes. The result is moved out of the task, so nothing else should read
+	 * it afterwards. May be called from any thread, but the result is used on the game thread.
+	 */
+	template<typename T>
+	TOGFuture<T> ToOGFuture(UE::Tasks::TTask<T> Task)
+	{
+		TSharedRef<TOGFutureState<T>> ResultState = OGAsync::MakeFutureState<T>();
+		if (!ensureAlwaysMsgf(Task.IsValid(), TEXT("Converting an invalid task"))) [[unlikely]]
+		{
+			OGAsync::RunOnGameThread([ResultState]() { ResultState->Throw(TEXT("Converted an invalid task")); });
+			return TOGFuture<T>(ResultState);
+		}
+
+		//Inline so the continuation runs straight from the completing worker instead of being scheduled again
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [ResultState, Task]() mutable
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				OGAsync::RunOnGameThread([ResultState]() { ResultState->Fulfill(); });
+			}
+			else
+			{
+				OGAsync::RunOnGameThread([ResultState, Value = MoveTemp(Task.GetResult())]() mutable { ResultState->Fulfill(MoveTemp(Value)); });
+			}
+		}, UE::Tasks::Prerequisites(Task), UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+		return TOGFuture<T>(ResultState);
+	}
+
+	/**
+	 * A task that completes once Future resolves, usable as a prerequisite for other tasks. It holds the value if the
+	 * future was fulfilled, or nothing if it was rejected. Tasks for void futures hold whether they were fulfilled.
+	 * Call from the game thread.
+	 */
+	template<typename T>
+	auto ToTask(const TOGFuture<T>& Future)
+	{
+		check(IsInGameThread());
+		typedef std::conditional_t<std::is_void_v<T>, bool, TOptional<T>> FResult;
+
+		UE::Tasks::FTaskEvent Resolved(UE_SOURCE_LOCATION);
+		if (!ensureAlways(Future.IsValid())) [[unlikely]]
+		{
+			Resolved.Trigger();
+			return UE::Tasks::Launch(UE_SOURCE_LOCATION, []() { return FResult(); }, Resolved);
+		}
+
+		Future->Then(FOGFutureState::FVoidThenDelegate::CreateLambda([Resolved]() mutable { Resolved.Trigger(); }));
+		Future->Catch(FOGFutureState::FCatchDelegate::CreateLambda([Resolved](const FString&) mutable { Resolved.Trigger(); }));
+
+		//The value never changes once the future resolves, so the worker can read it in place
+		return UE::Tasks::Launch(UE_SOURCE_LOCATION, [Future]() -> FResult
+		{
+			if constexpr (std::is_void_v<T>)
+			{
+				return Future->IsFulfilled();
+			}
+			else
+			{
+				return Future->IsFulfilled() ? FResult(Future->GetValueSafe()) : FResult();
+			}
+		}, Resolved, UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+	}
+}
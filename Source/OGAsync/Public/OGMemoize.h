@@ -0,0 +1,248 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Misc/SecureHash.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tasks/Task.h"
+
+struct FOGMemoCachePolicy
+{
+	//How many results are kept in memory, least recently used first out
+	int32 MaxMemoryEntries = 64;
+
+	//Also keep results on disk under Saved/OGAsync/Memo/<CacheName>, so they survive between sessions
+	bool bUseDiskCache = true;
+
+	//Required for the disk cache, results of different functions must never share a name
+	FString CacheName;
+
+	//Bump when the function's output changes for the same inputs, so stale results on disk are ignored
+	int32 Version = 0;
+};
+
+namespace OGAsync
+{
+	//Deletes every result the disk cache holds for CacheName
+	OGASYNC_API void ClearMemoCache(const FString& CacheName);
+}
+
+namespace OGAsync::Private
+{
+	OGASYNC_API FString GetMemoCachePath(const FString& CacheName, const FSHAHash& Key);
+
+	//Memory maps the file and hands the payload to Read, returns false if the file is missing, corrupt or Read fails
+	OGASYNC_API bool ReadMemoCacheFile(const FString& Path, TFunctionRef<bool(FArchive&)> Read);
+	OGASYNC_API void WriteMemoCacheFile(const FString& Path, const TArray<uint8>& Payload);
+
+	template<typename T>
+	concept CMemoSerializable = requires(FArchive& Ar, T& Value) { Ar << Value; };
+}
+
+/**
+ * A function returning futures whose results are cached by key, see OGAsync::Memoize.
+ * Copies share the same cache. Call from the game thread.
+ */
+template<typename T, typename... ArgTypes>
+class TOGMemoizedFunction
+{
+public:
+	typedef TFunction<TOGFuture<T>(const ArgTypes&...)> FFunction;
+	typedef TFunction<FSHAHash(const ArgTypes&...)> FKeyHasher;
+
+	TOGMemoizedFunction(FFunction InFunction, FKeyHasher InKeyHasher, const FOGMemoCachePolicy& InPolicy)
+		: Shared(MakeShared<FShared>(MoveTemp(InFunction), MoveTemp(InKeyHasher), InPolicy))
+	{
+	}
+
+	TOGFuture<T> operator()(const ArgTypes&... Args) const
+	{
+		check(IsInGameThread());
+		const FSHAHash Key = Shared->MakeKey(Args...);
+
+		if (const T* Cached = Shared->MemoryCache.FindAndTouch(Key))
+		{
+			TSharedRef<TOGFutureState<T>> ResultState = OGAsync::MakeFutureState<T>();
+			ResultState->Fulfill(*Cached);
+			return TOGFuture<T>(ResultState);
+		}
+
+		//Identical calls while the first is still running share its result
+		if (const TSharedRef<TOGFutureState<T>>* InFlight = Shared->InFlight.Find(Key))
+			return TOGFuture<T>(*InFlight);
+
+		TSharedRef<TOGFutureState<T>> ResultState = OGAsync::MakeFutureState<T>();
+		Shared->InFlight.Add(Key, ResultState);
+
+		TTuple<ArgTypes...> ArgsCopy(Args...);
+		if (Shared->UsesDiskCache())
+		{
+			FShared::ReadFromDisk(Shared, Key, MoveTemp(ArgsCopy));
+		}
+		else
+		{
+			FShared::Compute(Shared, Key, ArgsCopy);
+		}
+		return TOGFuture<T>(ResultState);
+	}
+
+	//The hash results are cached under, including the cache name and version
+	FSHAHash GetKey(const ArgTypes&... Args) const { return Shared->MakeKey(Args...); }
+
+	//Drops the in memory results, the disk cache is left alone
+	void ClearMemory() const { Shared->MemoryCache.Empty(Shared->MemoryCache.Max()); }
+
+private:
+	struct FShared
+	{
+		FShared(FFunction&& InFunction, FKeyHasher&& InKeyHasher, const FOGMemoCachePolicy& InPolicy)
+			: Function(MoveTemp(InFunction)), KeyHasher(MoveTemp(InKeyHasher)), Policy(InPolicy)
+			, MemoryCache(FMath::Max(1, InPolicy.MaxMemoryEntries))
+		{
+			if constexpr (!OGAsync::Private::CMemoSerializable<T>)
+			{
+				ensureAlwaysMsgf(!Policy.bUseDiskCache, TEXT("Memoized results can only be cached on disk if they can be serialised with operator<<"));
+			}
+			ensureAlwaysMsgf(!Policy.bUseDiskCache || !Policy.CacheName.IsEmpty(), TEXT("Memoized functions need a CacheName to use the disk cache"));
+		}
+
+		bool UsesDiskCache() const
+		{
+			return OGAsync::Private::CMemoSerializable<T> && Policy.bUseDiskCache && !Policy.CacheName.IsEmpty();
+		}
+
+		//The cache name and version are part of the key, so bumping either never serves an old result
+		FSHAHash MakeKey(const ArgTypes&... Args) const
+		{
+			const FSHAHash ArgsHash = KeyHasher(Args...);
+			FSHA1 Hasher;
+			Hasher.UpdateWithString(*Policy.CacheName, Policy.CacheName.Len());
+			Hasher.Update(reinterpret_cast<const uint8*>(&Policy.Version), sizeof(Policy.Version));
+			Hasher.Update(ArgsHash.Hash, sizeof(ArgsHash.Hash));
+			return Hasher.Finalize();
+		}
+
+		static void ReadFromDisk(const TSharedRef<FShared>& Self, const FSHAHash& Key, TTuple<ArgTypes...>&& Args)
+		{
+			if constexpr (OGAsync::Private::CMemoSerializable<T>)
+			{
+				UE::Tasks::Launch(UE_SOURCE_LOCATION, [Self, Key, Args = MoveTemp(Args)]() mutable
+				{
+					TOptional<T> Loaded;
+					OGAsync::Private::ReadMemoCacheFile(OGAsync::Private::GetMemoCachePath(Self->Policy.CacheName, Key), [&Loaded](FArchive& Ar)
+					{
+						T Value;
+						Ar << Value;
+						if (!Ar.IsError())
+						{
+							Loaded = MoveTemp(Value);
+						}
+						return !Ar.IsError();
+					});
+
+					OGAsync::RunOnGameThread([Self, Key, Args = MoveTemp(Args), Loaded = MoveTemp(Loaded)]() mutable
+					{
+						if (Loaded.IsSet())
+						{
+							Self->Resolve(Key, MoveTemp(Loaded.GetValue()));
+						}
+						else
+						{
+							Compute(Self, Key, Args);
+						}
+					});
+				}, UE::Tasks::ETaskPriority::BackgroundNormal);
+			}
+		}
+
+		static void Compute(const TSharedRef<FShared>& Self, const FSHAHash& Key, const TTuple<ArgTypes...>& Args)
+		{
+			const TOGFuture<T> Result = Args.ApplyAfter(Self->Function);
+			if (!Result.IsValid())
+			{
+				Self->Reject(Key, TEXT("Memoized function returned an invalid future"));
+				return;
+			}
+
+			Result->Then(typename TOGFutureState<T>::FThenDelegate::CreateLambda([Self, Key](const T& Value)
+			{
+				if (Self->UsesDiskCache())
+				{
+					Self->WriteToDisk(Key, Value);
+				}
+				Self->Resolve(Key, T(Value));
+			}));
+			Result->Catch(FOGFutureState::FCatchDelegate::CreateLambda([Self, Key](const FString& Reason)
+			{
+				Self->Reject(Key, Reason);
+			}));
+		}
+
+		void WriteToDisk(const FSHAHash& Key, const T& Value)
+		{
+			if constexpr (OGAsync::Private::CMemoSerializable<T>)
+			{
+				UE::Tasks::Launch(UE_SOURCE_LOCATION, [Path = OGAsync::Private::GetMemoCachePath(Policy.CacheName, Key), Value]() mutable
+				{
+					TArray<uint8> Payload;
+					FMemoryWriter Writer(Payload);
+					Writer << Value;
+					OGAsync::Private::WriteMemoCacheFile(Path, Payload);
+				}, UE::Tasks::ETaskPriority::BackgroundLow);
+			}
+		}
+
+		void Resolve(const FSHAHash& Key, T&& Value)
+		{
+			MemoryCache.Add(Key, Value);
+			TSharedRef<TOGFutureState<T>> ResultState = InFlight.FindAndRemoveChecked(Key);
+			ResultState->Fulfill(MoveTemp(Value));
+		}
+
+		void Reject(const FSHAHash& Key, const FString& Reason)
+		{
+			TSharedRef<TOGFutureState<T>> ResultState = InFlight.FindAndRemoveChecked(Key);
+			ResultState->Throw(Reason);
+		}
+
+		FFunction Function;
+		FKeyHasher KeyHasher;
+		FOGMemoCachePolicy Policy;
+		TLruCache<FSHAHash, T> MemoryCache;
+		TMap<FSHAHash, TSharedRef<TOGFutureState<T>>> InFlight;
+	};
+
+	TSharedRef<FShared> Shared;
+};
+
+namespace OGAsync
+{
+	/**
+	 * Wraps a deterministic function returning futures, such as a procedural generation or bake step, so that repeated
+	 * calls with the same key are served from a cache instead of recomputed.
+	 *
+	 * KeyHasher turns the arguments into a hash that identifies the result. Lookups check an in memory LRU first, then,
+	 * if the policy enables it, a content addressed disk cache that is read through a memory mapped file on a worker so
+	 * results survive between editor sessions. Concurrent calls with the same key share one computation. Results must
+	 * be copyable, and serialisable with operator<< to be cached on disk. Rejections are never cached.
+	 *
+	 * Usage:
+	 *	auto GenerateTile = OGAsync::Memoize<FIntPoint>([this](const FIntPoint& Coord) { return GenerateTileAsync(Coord); },
+	 *		[](const FIntPoint& Coord) { FSHA1 Hasher; Hasher.Update((const uint8*)&Coord, sizeof(Coord)); return Hasher.Finalize(); },
+	 *		FOGMemoCachePolicy{256, true, TEXT("TerrainTiles"), 3});
+	 *	GenerateTile(FIntPoint(4, 2))->WeakThen(this, [](const FTileData& Tile) { ... });
+	 */
+	template<typename... ArgTypes, typename Func, typename KeyHashFunc>
+	auto Memoize(Func&& Function, KeyHashFunc&& KeyHasher, const FOGMemoCachePolicy& Policy = FOGMemoCachePolicy())
+	{
+		typedef std::decay_t<TInvokeResult_T<Func, const ArgTypes&...>> FFutureType;
+		static_assert(std::is_convertible_v<FFutureType, FOGFuture>, "Memoized functions must return a TOGFuture");
+		typedef typename FFutureType::Type T;
+
+		return TOGMemoizedFunction<T, ArgTypes...>(Forward<Func>(Function), Forward<KeyHashFunc>(KeyHasher), Policy);
+	}
+}
@@ -0,0 +1,427 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "Tasks/Task.h"
+
+/**
+ * A chain of asynchronous stages that work items flow through, e.g. load -> decompress -> parse -> register.
+ *
+ * Every stage has a bounded input queue and a limit on how many items it works on at once. A stage only takes an item
+ * from its queue once the next stage has room for the result, so a slow stage applies backpressure all the way up the
+ * pipeline and memory use stays bounded no matter how fast items are pushed in. Each stage chooses its executor:
+ *	- GameThread: the stage function is called on the game thread. It may return the result directly or a future.
+ *	- Worker: the stage function returns the result directly and is called on UE::Tasks workers, up to MaxInFlight at
+ *	  once, so it must be safe to call concurrently.
+ *
+ * Pushing an item returns a future for that item's final result, which is rejected if any stage rejects the item.
+ * Once the input is closed, the completion future resolves after every accepted item has left the pipeline.
+ * Pipelines are driven from the game thread: push, close and attach to the futures from the game thread only.
+ *
+ * Usage:
+ *	TOGPipeline<FString, FMyAsset> Pipeline = TOGPipeline<FString>::Create([](const FString& Path) { return LoadBytes(Path); }, {4})
+ *		.AddStage([](const TArray<uint8>& Bytes) { return Decompress(Bytes); }, {8, 16, EOGPipelineExecutor::Worker})
+ *		.AddStage([this](const TArray<uint8>& Raw) { return Register(Raw); });
+ *
+ *	TOGFuture<FMyAsset> Asset;
+ *	if (!Pipeline.TryPush(Path, Asset))
+ *	{
+ *		Pipeline.WaitForCapacity()->WeakThen(this, [this]() { PushNext(); });
+ *	}
+ */
+enum class EOGPipelineExecutor : uint8
+{
+	GameThread,
+	Worker
+};
+
+struct FOGPipelineStageOptions
+{
+	//How many items this stage works on at once
+	int32 MaxInFlight = 1;
+
+	//How many items may wait in front of this stage, including results already promised by the stage before it
+	int32 QueueCapacity = 16;
+
+	EOGPipelineExecutor Executor = EOGPipelineExecutor::GameThread;
+};
+
+namespace OGAsync::Private
+{
+	template<typename T>
+	struct TOGUnwrapFuture
+	{
+		typedef T Type;
+		static constexpr bool bIsFuture = false;
+	};
+
+	template<typename T>
+	struct TOGUnwrapFuture<TOGFuture<T>>
+	{
+		typedef T Type;
+		static constexpr bool bIsFuture = true;
+	};
+
+	struct FOGPipelineShared
+	{
+		//Accepted but not yet fulfilled or rejected
+		int32 NumItemsInFlight = 0;
+		bool bClosed = false;
+		//The last stage of the pipeline that items are pushed into, set by the first push
+		const void* SealedTail = nullptr;
+		TSharedRef<TOGFutureState<void>> CompletionState = OGAsync::MakeFutureState<void>();
+		TArray<TSharedRef<TOGFutureState<void>>> CapacityWaiters;
+
+		void OnItemFinished()
+		{
+			--NumItemsInFlight;
+			TryComplete();
+		}
+
+		void TryComplete()
+		{
+			if (bClosed && NumItemsInFlight == 0 && CompletionState->IsPending())
+			{
+				CompletionState->Fulfill();
+			}
+		}
+	};
+
+	template<typename T>
+	struct TOGPipelineInput
+	{
+		virtual ~TOGPipelineInput() {}
+
+		//Counts queued items and results already promised by the previous stage
+		virtual bool HasCapacity() const = 0;
+		virtual void Reserve() = 0;
+		virtual void Unreserve() = 0;
+		virtual void Push(T&& Item, const TSharedRef<FOGFutureState>& Completion, bool bReserved) = 0;
+
+		//Set by whatever feeds this input, so it can resume when this input frees up space
+		TFunction<void()> OnCapacityAvailable;
+	};
+
+	template<typename T>
+	struct TOGPipelineOutput
+	{
+		virtual ~TOGPipelineOutput() {}
+		virtual void Pump() = 0;
+
+		TSharedPtr<TOGPipelineInput<T>> Next;
+	};
+
+	//End of the pipeline, fulfills the per item futures and never applies backpressure
+	template<typename T>
+	struct TOGPipelineSink : TOGPipelineInput<T>
+	{
+		explicit TOGPipelineSink(const TSharedRef<FOGPipelineShared>& InShared) : Shared(InShared) {}
+
+		virtual bool HasCapacity() const override { return true; }
+		virtual void Reserve() override {}
+		virtual void Unreserve() override {}
+		virtual void Push(T&& Item, const TSharedRef<FOGFutureState>& Completion, bool bReserved) override
+		{
+			static_cast<TOGFutureState<T>&>(Completion.Get()).Fulfill(MoveTemp(Item));
+			Shared->OnItemFinished();
+		}
+
+		TSharedRef<FOGPipelineShared> Shared;
+	};
+
+	template<typename InT, typename OutT>
+	struct TOGPipelineStage : TOGPipelineInput<InT>, TOGPipelineOutput<OutT>, TSharedFromThis<TOGPipelineStage<InT, OutT>>
+	{
+		typedef TFunction<OutT(InT&&)> FSyncWork;
+		typedef TFunction<TOGFuture<OutT>(InT&&)> FAsyncWork;
+
+		TOGPipelineStage(const TSharedRef<FOGPipelineShared>& InShared, const FOGPipelineStageOptions& InOptions)
+			: Shared(InShared), Options(InOptions)
+		{
+			Options.MaxInFlight = FMath::Max(1, Options.MaxInFlight);
+			Options.QueueCapacity = FMath::Max(1, Options.QueueCapacity);
+		}
+
+		virtual bool HasCapacity() const override { return Queue.Num() + NumReserved < Options.QueueCapacity; }
+		virtual void Reserve() override { ++NumReserved; }
+		virtual void Unreserve() override { --NumReserved; }
+
+		virtual void Push(InT&& Item, const TSharedRef<FOGFutureState>& Completion, bool bReserved) override
+		{
+			if (bReserved)
+			{
+				--NumReserved;
+			}
+			Queue.Emplace(MoveTemp(Item), Completion);
+			Pump();
+		}
+
+		virtual void Pump() override
+		{
+			if (bPumping)
+				return;
+			TGuardValue<bool> PumpGuard(bPumping, true);
+
+			bool bFreedSpace = false;
+			while (NumInFlight < Options.MaxInFlight && !Queue.IsEmpty() && this->Next->HasCapacity())
+			{
+				//Reserve the result's place downstream before starting, so finished work always has somewhere to go
+				this->Next->Reserve();
+				TTuple<InT, TSharedRef<FOGFutureState>> Entry = MoveTemp(Queue[0]);
+				Queue.RemoveAt(0);
+				++NumInFlight;
+				bFreedSpace = true;
+				Run(MoveTemp(Entry.template Get<0>()), Entry.template Get<1>());
+			}
+
+			if (bFreedSpace && this->OnCapacityAvailable)
+			{
+				this->OnCapacityAvailable();
+			}
+		}
+
+		void Run(InT&& Item, const TSharedRef<FOGFutureState>& Completion)
+		{
+			const TWeakPtr<TOGPipelineStage> WeakThis = this->AsShared();
+			if (AsyncWork)
+			{
+				const TOGFuture<OutT> Result = AsyncWork(MoveTemp(Item));
+				if (!Result.IsValid())
+				{
+					Fail(Completion, TEXT("Pipeline stage returned an invalid future"));
+					return;
+				}
+				Result->Then(typename TOGFutureState<OutT>::FThenDelegate::CreateLambda([WeakThis, Completion](const OutT& Value)
+				{
+					if (const TSharedPtr<TOGPipelineStage> Stage = WeakThis.Pin())
+					{
+						Stage->Deliver(OutT(Value), Completion);
+					}
+				}));
+				Result->Catch(FOGFutureState::FCatchDelegate::CreateLambda([WeakThis, Completion](const FString& Reason)
+				{
+					if (const TSharedPtr<TOGPipelineStage> Stage = WeakThis.Pin())
+					{
+						Stage->Fail(Completion, Reason);
+					}
+				}));
+			}
+			else if (Options.Executor == EOGPipelineExecutor::Worker)
+			{
+				UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Work = SyncWork, Item = MoveTemp(Item), Completion]() mutable
+				{
+					OGAsync::RunOnGameThread([WeakThis, Result = Work(MoveTemp(Item)), Completion]() mutable
+					{
+						if (const TSharedPtr<TOGPipelineStage> Stage = WeakThis.Pin())
+						{
+							Stage->Deliver(MoveTemp(Result), Completion);
+						}
+					});
+				});
+			}
+			else
+			{
+				Deliver(SyncWork(MoveTemp(Item)), Completion);
+			}
+		}
+
+		void Deliver(OutT&& Result, const TSharedRef<FOGFutureState>& Completion)
+		{
+			--NumInFlight;
+			this->Next->Push(MoveTemp(Result), Completion, true);
+			Pump();
+		}
+
+		void Fail(const TSharedRef<FOGFutureState>& Completion, const FString& Reason)
+		{
+			--NumInFlight;
+			this->Next->Unreserve();
+			Completion->Throw(Reason);
+			Shared->OnItemFinished();
+			Pump();
+		}
+
+		TSharedRef<FOGPipelineShared> Shared;
+		FOGPipelineStageOptions Options;
+		FSyncWork SyncWork;
+		FAsyncWork AsyncWork;
+
+		//Bounded by Options.QueueCapacity, so removing from the front stays cheap
+		TArray<TTuple<InT, TSharedRef<FOGFutureState>>> Queue;
+		int32 NumReserved = 0;
+		int32 NumInFlight = 0;
+		bool bPumping = false;
+	};
+}
+
+template<typename In, typename Out = In>
+class TOGPipeline
+{
+	template<typename, typename>
+	friend class TOGPipeline;
+
+public:
+	TOGPipeline() {}
+
+	//Starts a pipeline with its first stage. Work is invoked with the item as In&& and returns the result or a future of it
+	template<typename Func>
+	static auto Create(Func&& Work, const FOGPipelineStageOptions& Options = FOGPipelineStageOptions())
+	{
+		TOGPipeline<In, In> Empty;
+		Empty.Shared = MakeShared<OGAsync::Private::FOGPipelineShared>();
+		return Empty.AddStage(Forward<Func>(Work), Options);
+	}
+
+	//Appends a stage. Build the whole pipeline before pushing anything into it
+	template<typename Func>
+	auto AddStage(Func&& Work, const FOGPipelineStageOptions& Options = FOGPipelineStageOptions()) const
+	{
+		typedef OGAsync::Private::TOGUnwrapFuture<std::decay_t<TInvokeResult_T<Func, Out&&>>> FResult;
+		typedef typename FResult::Type NextOut;
+		typedef OGAsync::Private::TOGPipelineStage<Out, NextOut> FStage;
+		static_assert(!std::is_void_v<NextOut>, "Pipeline stages must produce a value for the next stage");
+
+		TOGPipeline<In, NextOut> Result;
+		Result.Shared = Shared;
+		if (!ensureAlwaysMsgf(Shared.IsValid() && !Shared->SealedTail, TEXT("Stages must be added to a pipeline created with Create, before anything is pushed")))
+			return Result;
+
+		const TSharedRef<FStage> Stage = MakeShared<FStage>(Shared.ToSharedRef(), Options);
+		if constexpr (FResult::bIsFuture)
+		{
+			ensureAlwaysMsgf(Options.Executor == EOGPipelineExecutor::GameThread, TEXT("Pipeline stages that return futures always run on the game thread"));
+			Stage->AsyncWork = Forward<Func>(Work);
+		}
+		else
+		{
+			Stage->SyncWork = Forward<Func>(Work);
+		}
+
+		if (Tail.IsValid())
+		{
+			Tail->Next = Stage;
+			const TWeakPtr<OGAsync::Private::TOGPipelineOutput<Out>> WeakTail = Tail;
+			Stage->OnCapacityAvailable = [WeakTail]()
+			{
+				if (const TSharedPtr<OGAsync::Private::TOGPipelineOutput<Out>> PinnedTail = WeakTail.Pin())
+				{
+					PinnedTail->Pump();
+				}
+			};
+			Result.Head = Head;
+		}
+		else if constexpr (std::is_same_v<In, Out>)
+		{
+			//Only the pipeline built by Create has no stages yet
+			Result.Head = Stage;
+		}
+		Result.Tail = Stage;
+		Result.Stages = Stages;
+		Result.Stages.Add(Stage);
+		return Result;
+	}
+
+	bool IsValid() const { return Head.IsValid(); }
+
+	//True if the first stage has room for another item
+	bool CanPush() const { return IsValid() && !Shared->bClosed && Head->HasCapacity(); }
+
+	//Pushes an item if the first stage has room, OutFuture resolves with the item's result from the last stage
+	bool TryPush(In Item, TOGFuture<Out>& OutFuture)
+	{
+		if (!CanPush() || !Seal())
+			return false;
+
+		const TSharedRef<TOGFutureState<Out>> Completion = OGAsync::MakeFutureState<Out>();
+		OutFuture = TOGFuture<Out>(Completion);
+		++Shared->NumItemsInFlight;
+		Head->Push(MoveTemp(Item), Completion, false);
+		return true;
+	}
+
+	//Resolves as soon as the first stage has room for another item
+	TOGFuture<void> WaitForCapacity()
+	{
+		TSharedRef<TOGFutureState<void>> Waiter = OGAsync::MakeFutureState<void>();
+		if (!IsValid())
+		{
+			Waiter->Throw(TEXT("Pipeline has no stages"));
+		}
+		else if (Shared->bClosed)
+		{
+			Waiter->Throw(TEXT("Pipeline input is closed"));
+		}
+		else if (Head->HasCapacity())
+		{
+			Waiter->Fulfill();
+		}
+		else if (!Seal())
+		{
+			Waiter->Throw(TEXT("Pipeline was extended, push into the last stage instead"));
+		}
+		else
+		{
+			Shared->CapacityWaiters.Add(Waiter);
+		}
+		return TOGFuture<void>(Waiter);
+	}
+
+	//Stops accepting items, the returned future resolves once everything already pushed has left the pipeline
+	TOGFuture<void> Close()
+	{
+		if (!IsValid())
+			return TOGFuture<void>();
+
+		Shared->bClosed = true;
+		for (const TSharedRef<TOGFutureState<void>>& Waiter : Shared->CapacityWaiters)
+		{
+			Waiter->Throw(TEXT("Pipeline input is closed"));
+		}
+		Shared->CapacityWaiters.Empty();
+		Shared->TryComplete();
+		return GetCompletionFuture();
+	}
+
+	TOGFuture<void> GetCompletionFuture() const
+	{
+		return IsValid() ? TOGFuture<void>(Shared->CompletionState) : TOGFuture<void>();
+	}
+
+private:
+	bool Seal()
+	{
+		if (Shared->SealedTail)
+			return ensureAlwaysMsgf(Shared->SealedTail == Tail.Get(), TEXT("Only the pipeline returned by the last AddStage can be pushed into"));
+		if (!ensureAlwaysMsgf(!Tail->Next.IsValid(), TEXT("Only the pipeline returned by the last AddStage can be pushed into")))
+			return false;
+
+		Shared->SealedTail = Tail.Get();
+		Tail->Next = MakeShared<OGAsync::Private::TOGPipelineSink<Out>>(Shared.ToSharedRef());
+
+		//Capacity waiters are woken from the first stage, one per freed slot
+		const TWeakPtr<OGAsync::Private::FOGPipelineShared> WeakShared = Shared;
+		Head->OnCapacityAvailable = [WeakShared]()
+		{
+			if (const TSharedPtr<OGAsync::Private::FOGPipelineShared> PinnedShared = WeakShared.Pin())
+			{
+				if (!PinnedShared->CapacityWaiters.IsEmpty())
+				{
+					const TSharedRef<TOGFutureState<void>> Waiter = PinnedShared->CapacityWaiters[0];
+					PinnedShared->CapacityWaiters.RemoveAt(0);
+					Waiter->Fulfill();
+				}
+			}
+		};
+		return true;
+	}
+
+	TSharedPtr<OGAsync::Private::FOGPipelineShared> Shared;
+	TSharedPtr<OGAsync::Private::TOGPipelineInput<In>> Head;
+	TSharedPtr<OGAsync::Private::TOGPipelineOutput<Out>> Tail;
+
+	//Keeps every stage alive, stages only refer to the one before them weakly
+	TArray<TSharedPtr<void>> Stages;
+};
@@ -0,0 +1,147 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGFuture.h"
+#include <atomic>
+
+/**
+ * Carries the progress of a long running operation, from 0 to 1, alongside its future.
+ *
+ * Producers report progress from any thread with SetProgress, which is an atomic store and a fence in the common case.
+ * Consumers subscribe on the game thread and are notified at most once per frame with the latest value, however often
+ * the producer reports, so reporting progress per item of a large batch costs next to nothing.
+ */
+class OGASYNC_API FOGProgressChannel : public TSharedFromThis<FOGProgressChannel>
+{
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnProgress, float);
+
+	//Any thread. Values are clamped to [0, 1]
+	void SetProgress(float InProgress);
+
+	float GetProgress() const { return Progress.load(std::memory_order_relaxed); }
+
+	//Game thread. Lambda(float Progress) is called at most once per frame while the progress is changing
+	template<typename Func>
+	FDelegateHandle OnProgress(const UObject* Context, Func&& Lambda)
+	{
+		check(IsInGameThread());
+		return OnProgressDelegate.Add(FOnProgress::FDelegate::CreateWeakLambda(Context, Forward<Func>(Lambda)));
+	}
+
+	void RemoveOnProgress(FDelegateHandle Handle)
+	{
+		OnProgressDelegate.Remove(Handle);
+	}
+
+	//Notifies every channel whose progress changed since the last flush, normally done once per frame automatically
+	static void FlushNotifications();
+
+	//Combines children into one channel whose progress is their weighted average, updated as they report
+	static TSharedRef<FOGProgressChannel> MakeComposite(const TArray<TSharedRef<FOGProgressChannel>>& Children, const TArray<float>& Weights = TArray<float>());
+
+private:
+	void Notify();
+
+	std::atomic<float> Progress = 0.f;
+	std::atomic<bool> bNotificationQueued = false;
+	float NotifiedProgress = 0.f;
+	FOnProgress OnProgressDelegate;
+};
+
+/**
+ * A future that also reports progress. It is a TOGFuture<T> in every other respect and can be passed on as one.
+ *
+ * Usage:
+ *	TOGProgressFuture<FBakeResult> Bake = BakeAsync();
+ *	Bake.OnProgress(this, [this](float Progress) { ProgressBar->SetPercent(Progress); });
+ *	Bake->WeakThen(this, [](const FBakeResult& Result) { ... });
+ */
+template<typename T>
+struct TOGProgressFuture : TOGFuture<T>
+{
+	TOGProgressFuture() {}
+	TOGProgressFuture(const TOGFuture<T>& Future, const TSharedRef<FOGProgressChannel>& InChannel) : TOGFuture<T>(Future), Channel(InChannel) {}
+
+	float GetProgress() const { return Channel.IsValid() ? Channel->GetProgress() : 0.f; }
+
+	template<typename Func>
+	FDelegateHandle OnProgress(const UObject* Context, Func&& Lambda) const
+	{
+		return Channel->OnProgress(Context, Forward<Func>(Lambda));
+	}
+
+	const TSharedPtr<FOGProgressChannel>& GetChannel() const { return Channel; }
+
+private:
+	TSharedPtr<FOGProgressChannel> Channel;
+};
+
+//Untyped progress future, used to aggregate the progress of futures of different types
+struct FOGProgressFuture
+{
+	FOGProgressFuture() {}
+	template<typename T>
+	FOGProgressFuture(const TOGProgressFuture<T>& InFuture) : Future(InFuture), Channel(InFuture.GetChannel()) {}
+
+	FOGFuture Future;
+	TSharedPtr<FOGProgressChannel> Channel;
+};
+
+/**
+ * A promise with a progress channel. Fulfilling it reports full progress.
+ *
+ * Usage:
+ *	TOGProgressPromise<FBakeResult> Promise;
+ *	TOGProgressFuture<FBakeResult> Future = Promise.GetFuture();
+ *	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Channel = Promise.GetChannel(), ...]()
+ *	{
+ *		for (int32 Index = 0; Index < Num; ++Index)
+ *		{
+ *			BakeItem(Index);
+ *			Channel->SetProgress(float(Index + 1) / Num);
+ *		}
+ *	});
+ */
+template<typename T>
+struct TOGProgressPromise
+{
+	TOGProgressPromise() : Channel(MakeShared<FOGProgressChannel>()) {}
+
+	TOGProgressFuture<T> GetFuture() { return TOGProgressFuture<T>(TOGFuture<T>(Promise), Channel); }
+	operator TOGProgressFuture<T>() { return GetFuture(); }
+
+	//Handed to workers, so they can report progress without touching the promise
+	const TSharedRef<FOGProgressChannel>& GetChannel() const { return Channel; }
+	void SetProgress(float Progress) const { Channel->SetProgress(Progress); }
+
+	template<typename... ArgTypes>
+	void Fulfill(ArgTypes&&... Args)
+	{
+		Channel->SetProgress(1.f);
+		Promise->Fulfill(Forward<ArgTypes>(Args)...);
+	}
+
+	void Throw(const FString& Reason)
+	{
+		Promise->Throw(Reason);
+	}
+
+	TOGFutureState<T>* operator->() const { return Promise.operator->(); }
+
+private:
+	TOGPromise<T> Promise;
+	TSharedRef<FOGProgressChannel> Channel;
+};
+
+namespace OGAsync
+{
+	/**
+	 * Like UOGFutureUtilities::FutureAll, resolves once every future has resolved or rejects with the first failure,
+	 * and also reports the weighted average progress of all of them. Futures count as fully progressed once they
+	 * resolve, even if their producer never reported progress. Weights default to equal.
+	 */
+	OGASYNC_API TOGProgressFuture<void> FutureAll(const UObject* Context, const TArray<FOGProgressFuture>& WaitForAll, const TArray<float>& Weights = TArray<float>());
+}
@@ -0,0 +1,87 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "OGFuture.h"
+#include "OGTaskGraph.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "OGStartupSubsystem.generated.h"
+
+/**
+ * Orchestrates asynchronous game instance startup.
+ *
+ * Instead of doing all of their work serially in Initialize, subsystems register startup steps along with the steps
+ * they depend on. Once every subsystem has initialized, the steps are run as a TOGTaskGraphBuilder graph so that
+ * independent steps overlap:
+ *	- Game thread steps are started in time slices, a few per frame within OGAsync.Startup.FrameBudgetMs, so a long
+ *	  chain of small steps doesn't hitch a single frame.
+ *	- Worker steps run on UE::Tasks workers and never touch the game thread.
+ *
+ * The ready future resolves once every step has resolved, or rejects with the first failure. The startup timeline
+ * (per step start offset, duration and the critical path) is logged when startup finishes, and written to
+ * Saved/Profiling/OGStartupTimeline.csv when OGAsync.Startup.WriteTimeline is set, so regressions can be diffed.
+ *
+ * Usage:
+ *	void UMyInventorySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+ *	{
+ *		UOGStartupSubsystem* Startup = Collection.InitializeDependency<UOGStartupSubsystem>();
+ *		Startup->AddStep("Inventory.LoadDefinitions", [this]() { return LoadDefinitions(); });
+ *		Startup->AddWorkerStep("Inventory.BuildIndex", [this]() { BuildIndex(); }, {"Inventory.LoadDefinitions"});
+ *	}
+ */
+UCLASS()
+class OGASYNC_API UOGStartupSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+	friend class FOGAsyncStartupSubsystemTest;
+
+public:
+	typedef TOGTaskGraphBuilder<>::FReport FTimeline;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//Adds a step that is started on the game thread and is complete when its future resolves
+	void AddStep(FName Name, TFunction<TOGFuture<void>()> Step, const TArray<FName>& Dependencies = TArray<FName>());
+
+	//Adds a step that runs synchronously on a worker thread, it must not touch game thread only state
+	void AddWorkerStep(FName Name, TFunction<void()> Work, const TArray<FName>& Dependencies = TArray<FName>());
+
+	//Resolves once every startup step has resolved
+	TOGFuture<void> GetReadyFuture() { return ReadyPromise; }
+
+	//Resolves with the startup timeline once every startup step has resolved
+	TOGFuture<FTimeline> GetTimeline() { return TimelinePromise; }
+
+	bool HasStarted() const { return bStarted; }
+
+protected:
+	struct FReadyStep
+	{
+		FName Name;
+		TSharedPtr<TOGFutureState<void>> StepState;
+	};
+
+	bool Tick(float DeltaTime);
+	void StartGraph();
+	void StartGameThreadStep(const FReadyStep& ReadyStep);
+	void OnStartupFinished(const FTimeline& Timeline);
+
+	TOGTaskGraphBuilder<> Graph;
+	TMap<FName, TFunction<TOGFuture<void>()>> GameThreadSteps;
+
+	//Game thread steps whose dependencies have resolved, waiting for a frame slice to start them
+	TArray<FReadyStep> ReadyGameThreadSteps;
+
+	//When each game thread step was actually started, the graph only sees when it was queued
+	TMap<FName, double> GameThreadStartTimes;
+
+	TOGPromise<void> ReadyPromise;
+	TOGPromise<FTimeline> TimelinePromise;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	bool bStarted = false;
+};
@@ -0,0 +1,133 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+#include "Tasks/Pipe.h"
+
+/**
+ * A serial queue of work that runs on worker threads. Everything posted to a strand runs one at a time, in the order
+ * it was posted, but not necessarily on the same worker. State that is only ever touched from one strand needs no
+ * locks and no trip through the game thread, while different strands still run side by side.
+ *
+ * Continuations are posted with ThenOn, and their results are marshalled back to the game thread:
+ *	Strand.Run([this]() { return Inventory.Num(); });
+ *	LoadFuture->ThenOn(Strand, this, [this](const FItemData& Data) { Inventory.Add(Data); });
+ *
+ * The owner of the strand should be the Context passed to ThenOn, so no continuation is posted after the strand is gone.
+ * The strand waits for everything already posted to finish when it is destroyed.
+ */
+class FOGStrand : public FNoncopyable
+{
+public:
+	explicit FOGStrand(const TCHAR* InDebugName = TEXT("OGStrand"))
+		: Pipe(InDebugName)
+	{
+	}
+
+	~FOGStrand()
+	{
+		ensureAlwaysMsgf(!IsInStrand(), TEXT("A strand can't be destroyed from its own work"));
+		WaitUntilIdle();
+	}
+
+	//Runs Work on a worker after everything posted before it has finished
+	template<typename Func>
+	void Post(Func&& Work, UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal)
+	{
+		Pipe.Launch(UE_SOURCE_LOCATION, Forward<Func>(Work), Priority);
+	}
+
+	//Like Post, but resolves the returned future with Work's result on the game thread
+	template<typename Func>
+	TOGFuture<std::decay_t<TInvokeResult_T<Func>>> Run(Func&& Work, UE::Tasks::ETaskPriority Priority = UE::Tasks::ETaskPriority::Normal);
+
+	bool IsIdle() const { return !Pipe.HasWork(); }
+
+	//True while called from work running on this strand
+	bool IsInStrand() const { return Pipe.IsInContext(); }
+
+	bool WaitUntilIdle(FTimespan Timeout = FTimespan::MaxValue()) { return Pipe.WaitUntilEmpty(Timeout); }
+
+private:
+	UE::Tasks::FPipe Pipe;
+};
+
+namespace OGAsync::Private
+{
+	template<typename R, typename Func>
+	void InvokeAndFulfillOnGameThread(const TSharedRef<TOGFutureState<R>>& State, Func& Work)
+	{
+		static_assert(!std::is_convertible_v<R, FOGFuture>, "Work run on a strand should return a value, not a future");
+
+		if constexpr (std::is_void_v<R>)
+		{
+			Work();
+			OGAsync::RunOnGameThread([State]() { State->Fulfill(); });
+		}
+		else
+		{
+			OGAsync::RunOnGameThread([State, Result = Work()]() mutable { State->Fulfill(MoveTemp(Result)); });
+		}
+	}
+}
+
+template<typename Func>
+TOGFuture<std::decay_t<TInvokeResult_T<Func>>> FOGStrand::Run(Func&& Work, UE::Tasks::ETaskPriority Priority)
+{
+	typedef std::decay_t<TInvokeResult_T<Func>> R;
+	TSharedRef<TOGFutureState<R>> ResultState = OGAsync::MakeFutureState<R>();
+	Post([ResultState, Work = Forward<Func>(Work)]() mutable
+	{
+		OGAsync::Private::InvokeAndFulfillOnGameThread(ResultState, Work);
+	}, Priority);
+	return TOGFuture<R>(ResultState);
+}
+
+template<typename Func>
+auto TOGFutureState<void>::ThenOn(FOGStrand& Strand, const UObject* Context, Func&& Lambda) const
+{
+	typedef std::decay_t<TInvokeResult_T<Func>> R;
+	TSharedRef<TOGFutureState<R>> NextState = OGAsync::MakeFutureState<R>();
+	TOGFuture<R> NextFuture(NextState);
+
+	FOGStrand* StrandPtr = &Strand;
+	WeakThen(Context, [StrandPtr, NextState, Lambda = Forward<Func>(Lambda)]() mutable
+	{
+		StrandPtr->Post([NextState, Lambda]() mutable
+		{
+			OGAsync::Private::InvokeAndFulfillOnGameThread(NextState, Lambda);
+		});
+	}, [NextState](const FString& Reason) mutable
+	{
+		NextState->Throw(Reason);
+	});
+	return NextFuture;
+}
+
+template<typename T>
+template<typename Func>
+auto TOGFutureState<T>::ThenOn(FOGStrand& Strand, const UObject* Context, Func&& Lambda) const
+{
+	typedef std::decay_t<TInvokeResult_T<Func, const T&>> R;
+	TSharedRef<TOGFutureState<R>> NextState = OGAsync::MakeFutureState<R>();
+	TOGFuture<R> NextFuture(NextState);
+
+	//The strand reads the fulfilled value straight out of this state, so keep it alive instead of copying the value
+	const TSharedRef<const TOGFutureState> Self = StaticCastSharedRef<const TOGFutureState>(this->AsShared());
+	FOGStrand* StrandPtr = &Strand;
+	WeakThen(Context, [StrandPtr, Self, NextState, Lambda = Forward<Func>(Lambda)]() mutable
+	{
+		StrandPtr->Post([Self, NextState, Lambda]() mutable
+		{
+			auto Invoke = [&Self, &Lambda]() { return Lambda(Self->GetValueSafe()); };
+			OGAsync::Private::InvokeAndFulfillOnGameThread(NextState, Invoke);
+		});
+	}, [NextState](const FString& Reason) mutable
+	{
+		NextState->Throw(Reason);
+	});
+	return NextFuture;
+}
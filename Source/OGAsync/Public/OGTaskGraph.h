@@ -0,0 +1,348 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGFuture.h"
+
+/**
+ * Builds a graph of asynchronous steps and runs each step as soon as everything it depends on has resolved.
+ * Nodes are functions that return a future, edges are declared dependencies between nodes. This replaces hand wiring
+ * FutureAll and nested WeakThen calls, which makes it too easy to serialise steps that could run side by side.
+ *
+ * The graph is validated before anything runs: unknown dependencies and cycles reject the run future up front.
+ * If any node rejects, nodes that depend on it are never started and the run future is rejected with the reason.
+ * Once every node has resolved the run future is fulfilled with a report of each node's timing and the critical path,
+ * which is the chain of nodes that actually gated the finish time.
+ *
+ * Usage:
+ *	TOGTaskGraphBuilder<> Graph;
+ *	Graph.AddNode("LoadConfig", [this]() { return LoadConfig(); });
+ *	Graph.AddNode("LoadAssets", [this]() { return LoadAssets(); });
+ *	Graph.AddNode("SpawnWorld", [this]() { return SpawnWorld(); }, {"LoadConfig", "LoadAssets"});
+ *	Graph.Run(this)->WeakThen(this, [](const TOGTaskGraphBuilder<>::FReport& Report)
+ *	{
+ *		UE_LOG(LogTemp, Log, TEXT("%s"), *Report.ToString());
+ *	});
+ */
+template<typename KeyType = FName>
+class TOGTaskGraphBuilder
+{
+public:
+	typedef TFunction<FOGFuture()> FNodeFunction;
+
+	struct FNodeTiming
+	{
+		KeyType Key;
+		double StartTime = 0.0;
+		double EndTime = 0.0;
+
+		double GetDuration() const { return EndTime - StartTime; }
+	};
+
+	struct FReport
+	{
+		//In the order the nodes were started
+		TArray<FNodeTiming> Nodes;
+
+		//From the first node on the path to the node that finished last
+		TArray<KeyType> CriticalPath;
+		double CriticalPathSeconds = 0.0;
+		double TotalSeconds = 0.0;
+
+		FString ToString() const
+		{
+			FString Result = FString::Printf(TEXT("Task graph finished in %.2fms, critical path:"), TotalSeconds * 1000.0);
+			for (const KeyType& Key : CriticalPath)
+			{
+				Result += FString::Printf(TEXT(" %s"), *LexToString(Key));
+			}
+			for (const FNodeTiming& Timing : Nodes)
+			{
+				Result += FString::Printf(TEXT("\n\t%s: +%.2fms, %.2fms"), *LexToString(Timing.Key),
+					(Timing.StartTime - (Nodes.IsEmpty() ? 0.0 : Nodes[0].StartTime)) * 1000.0, Timing.GetDuration() * 1000.0);
+			}
+			return Result;
+		}
+	};
+
+	TOGTaskGraphBuilder& AddNode(const KeyType& Key, FNodeFunction Function, const TArray<KeyType>& Dependencies = TArray<KeyType>())
+	{
+		if (!ensureAlwaysMsgf(!NodeIndices.Contains(Key), TEXT("Task graph node %s was added twice"), *LexToString(Key)))
+			return *this;
+
+		NodeIndices.Add(Key, Nodes.Num());
+		Nodes.Add(FNode{Key, MoveTemp(Function), Dependencies});
+		return *this;
+	}
+
+	//Dependencies can also be declared separately, e.g. when the dependent node is added by another system
+	TOGTaskGraphBuilder& AddDependency(const KeyType& Node, const KeyType& DependsOn)
+	{
+		if (const int32* Index = NodeIndices.Find(Node))
+		{
+			Nodes[*Index].Dependencies.AddUnique(DependsOn);
+		}
+		else
+		{
+			ensureAlwaysMsgf(false, TEXT("Tried to add a dependency to unknown task graph node %s"), *LexToString(Node));
+		}
+		return *this;
+	}
+
+	bool Contains(const KeyType& Key) const { return NodeIndices.Contains(Key); }
+	int32 Num() const { return Nodes.Num(); }
+
+	//Checks for unknown dependencies and cycles, and produces an order in which every node comes after its dependencies
+	bool Validate(FString* OutError = nullptr, TArray<int32>* OutTopologicalOrder = nullptr) const
+	{
+		TArray<int32> NumUnresolved;
+		NumUnresolved.SetNumZeroed(Nodes.Num());
+		TArray<TArray<int32>> Dependents;
+		Dependents.SetNum(Nodes.Num());
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			for (const KeyType& Dependency : Nodes[Index].Dependencies)
+			{
+				const int32* DependencyIndex = NodeIndices.Find(Dependency);
+				if (!DependencyIndex)
+				{
+					if (OutError)
+					{
+						*OutError = FString::Printf(TEXT("Task graph node %s depends on unknown node %s"), *LexToString(Nodes[Index].Key), *LexToString(Dependency));
+					}
+					return false;
+				}
+				Dependents[*DependencyIndex].Add(Index);
+				NumUnresolved[Index]++;
+			}
+		}
+
+		//Kahn's algorithm, anything left with unresolved dependencies at the end is part of, or behind, a cycle
+		TArray<int32> Order;
+		Order.Reserve(Nodes.Num());
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			if (NumUnresolved[Index] == 0)
+			{
+				Order.Add(Index);
+			}
+		}
+		for (int32 Cursor = 0; Cursor < Order.Num(); ++Cursor)
+		{
+			for (const int32 Dependent : Dependents[Order[Cursor]])
+			{
+				if (--NumUnresolved[Dependent] == 0)
+				{
+					Order.Add(Dependent);
+				}
+			}
+		}
+
+		if (Order.Num() != Nodes.Num())
+		{
+			if (OutError)
+			{
+				*OutError = TEXT("Task graph has a dependency cycle involving:");
+				for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+				{
+					if (NumUnresolved[Index] > 0)
+					{
+						*OutError += FString::Printf(TEXT(" %s"), *LexToString(Nodes[Index].Key));
+					}
+				}
+			}
+			return false;
+		}
+
+		if (OutTopologicalOrder)
+		{
+			*OutTopologicalOrder = MoveTemp(Order);
+		}
+		return true;
+	}
+
+	/**
+	 * Starts every node without dependencies immediately, and every other node as soon as its last dependency resolves.
+	 * Node functions are called on the game thread. The builder can be run again, each run calls the node functions anew.
+	 * If Context is destroyed before the run finishes, no further nodes are started and the run future is rejected.
+	 */
+	TOGFuture<FReport> Run(const UObject* Context) const
+	{
+		TSharedRef<TOGFutureState<FReport>> ResultState = OGAsync::MakeFutureState<FReport>();
+		TOGFuture<FReport> ResultFuture(ResultState);
+
+		FString Error;
+		if (!Validate(&Error))
+		{
+			ResultState->Throw(Error);
+			return ResultFuture;
+		}
+		if (Nodes.IsEmpty())
+		{
+			ResultState->Fulfill(FReport());
+			return ResultFuture;
+		}
+
+		const TSharedRef<FRun> RunState = MakeShared<FRun>(Nodes, NodeIndices, Context, ResultState);
+		for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+		{
+			if (RunState->NumUnresolved[Index] == 0)
+			{
+				FRun::StartNode(RunState, Index);
+			}
+		}
+		return ResultFuture;
+	}
+
+private:
+	struct FNode
+	{
+		KeyType Key;
+		FNodeFunction Function;
+		TArray<KeyType> Dependencies;
+	};
+
+	struct FRun
+	{
+		FRun(const TArray<FNode>& InNodes, const TMap<KeyType, int32>& NodeIndices, const UObject* InContext, const TSharedRef<TOGFutureState<FReport>>& InResultState)
+			: Nodes(InNodes), Context(InContext), ResultState(InResultState)
+		{
+			NumUnresolved.SetNumZeroed(Nodes.Num());
+			Dependents.SetNum(Nodes.Num());
+			DependencyIndices.SetNum(Nodes.Num());
+			Timings.SetNum(Nodes.Num());
+			for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+			{
+				for (const KeyType& Dependency : Nodes[Index].Dependencies)
+				{
+					const int32 DependencyIndex = NodeIndices.FindChecked(Dependency);
+					Dependents[DependencyIndex].Add(Index);
+					DependencyIndices[Index].Add(DependencyIndex);
+					NumUnresolved[Index]++;
+				}
+			}
+			NumRemaining = Nodes.Num();
+			StartTime = FPlatformTime::Seconds();
+		}
+
+		static void StartNode(const TSharedRef<FRun>& Run, int32 Index)
+		{
+			if (!Run->ResultState->IsPending() || !Run->CheckContext())
+				return;
+
+			Run->Timings[Index].Key = Run->Nodes[Index].Key;
+			Run->Timings[Index].StartTime = FPlatformTime::Seconds();
+			Run->StartOrder.Add(Index);
+
+			const FOGFuture NodeFuture = Run->Nodes[Index].Function ? Run->Nodes[Index].Function() : FOGFuture::EmptyFuture;
+			if (!NodeFuture.IsValid())
+			{
+				Run->ResultState->Throw(FString::Printf(TEXT("Task graph node %s did not return a valid future"), *LexToString(Run->Nodes[Index].Key)));
+				return;
+			}
+
+			//Not bound weakly to the context, a node resolving after the context is gone has to reject the run rather than leave it pending
+			(void)NodeFuture->Catch(FOGFutureState::FCatchDelegate::CreateLambda([Run, Index](const FString& Reason)
+			{
+				if (Run->ResultState->IsPending())
+				{
+					Run->ResultState->Throw(FString::Printf(TEXT("Task graph node %s failed: %s"), *LexToString(Run->Nodes[Index].Key), *Reason));
+				}
+			}));
+			(void)NodeFuture->Then(FOGFutureState::FVoidThenDelegate::CreateLambda([Run, Index]()
+			{
+				if (Run->CheckContext())
+				{
+					CompleteNode(Run, Index);
+				}
+			}));
+		}
+
+		//Rejects the run if the context it was started with has been destroyed
+		bool CheckContext()
+		{
+			if (Context.IsValid()) [[likely]]
+				return true;
+
+			if (ResultState->IsPending())
+			{
+				ResultState->Throw(TEXT("Task graph context was destroyed before the run finished"));
+			}
+			return false;
+		}
+
+		static void CompleteNode(const TSharedRef<FRun>& Run, int32 Index)
+		{
+			Run->Timings[Index].EndTime = FPlatformTime::Seconds();
+			if (--Run->NumRemaining == 0)
+			{
+				Run->Finish();
+				return;
+			}
+
+			for (const int32 Dependent : Run->Dependents[Index])
+			{
+				if (--Run->NumUnresolved[Dependent] == 0)
+				{
+					StartNode(Run, Dependent);
+				}
+			}
+		}
+
+		void Finish()
+		{
+			if (!ResultState->IsPending())
+				return;
+
+			FReport Report;
+			Report.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+			for (const int32 Index : StartOrder)
+			{
+				Report.Nodes.Add(Timings[Index]);
+			}
+
+			//Walk back from the last node to finish, always through the dependency that resolved last and so gated the start
+			int32 Current = INDEX_NONE;
+			for (int32 Index = 0; Index < Timings.Num(); ++Index)
+			{
+				if (Current == INDEX_NONE || Timings[Index].EndTime > Timings[Current].EndTime)
+				{
+					Current = Index;
+				}
+			}
+			while (Current != INDEX_NONE)
+			{
+				Report.CriticalPath.Insert(Nodes[Current].Key, 0);
+				Report.CriticalPathSeconds += Timings[Current].GetDuration();
+
+				int32 Gate = INDEX_NONE;
+				for (const int32 Dependency : DependencyIndices[Current])
+				{
+					if (Gate == INDEX_NONE || Timings[Dependency].EndTime > Timings[Gate].EndTime)
+					{
+						Gate = Dependency;
+					}
+				}
+				Current = Gate;
+			}
+
+			ResultState->Fulfill(MoveTemp(Report));
+		}
+
+		TArray<FNode> Nodes;
+		TWeakObjectPtr<const UObject> Context;
+		TSharedRef<TOGFutureState<FReport>> ResultState;
+
+		TArray<int32> NumUnresolved;
+		TArray<TArray<int32>> Dependents;
+		TArray<TArray<int32>> DependencyIndices;
+		TArray<FNodeTiming> Timings;
+		TArray<int32> StartOrder;
+		int32 NumRemaining = 0;
+		double StartTime = 0.0;
+	};
+
+	TArray<FNode> Nodes;
+	TMap<KeyType, int32> NodeIndices;
+};
@@ -0,0 +1,16 @@
+﻿using UnrealBuildTool;
+
+public class OGAsyncAllocationCounter : ModuleRules
+{
+	public OGAsyncAllocationCounter(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core"
+			}
+		);
+	}
+}
@@ -0,0 +1,62 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncAllocationCounterModule.h"
+
+#include "HAL/MemoryBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+	thread_local uint64 ThreadAllocations = 0;
+	bool bInstalled = false;
+
+	//Forwards everything to the allocator it wraps, counting allocations made by each thread
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override { ++ThreadAllocations; return Inner->Malloc(Count, Alignment); }
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override { ++ThreadAllocations; return Inner->TryMalloc(Count, Alignment); }
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override { ++ThreadAllocations; return Inner->Realloc(Original, Count, Alignment); }
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override { ++ThreadAllocations; return Inner->TryRealloc(Original, Count, Alignment); }
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		FMalloc* Inner;
+	};
+}
+
+void FOGAsyncAllocationCounterModule::StartupModule()
+{
+	if (!bInstalled && FParse::Param(FCommandLine::Get(), TEXT("OGAsyncCountAllocations")))
+	{
+		bInstalled = true;
+		GMalloc = new FCountingMalloc(GMalloc);
+	}
+}
+
+bool FOGAsyncAllocationCounterModule::IsInstalled()
+{
+	return bInstalled;
+}
+
+uint64 FOGAsyncAllocationCounterModule::GetThreadAllocationCount()
+{
+	return ThreadAllocations;
+}
+
+IMPLEMENT_MODULE(FOGAsyncAllocationCounterModule, OGAsyncAllocationCounter)
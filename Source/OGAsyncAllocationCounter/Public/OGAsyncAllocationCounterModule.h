@@ -0,0 +1,28 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+/**
+ * Counts heap allocations per thread for the OGAsync benchmarks, by wrapping GMalloc in a counting proxy.
+ *
+ * The proxy is only installed when the process is started with -OGAsyncCountAllocations, e.g.
+ * UnrealEditor-Cmd Project.uproject -run=OGAsyncBenchmark -OGAsyncCountAllocations -unattended -nullrhi
+ * The module loads at EarliestPossible, before the task graph starts its workers, so the swap doesn't race with other
+ * threads reading GMalloc. The proxy is never removed, blocks allocated before it are freed through it into the
+ * allocator that made them.
+ */
+class FOGAsyncAllocationCounterModule : public IModuleInterface
+{
+public:
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override {}
+
+	//False unless the process was started with -OGAsyncCountAllocations
+	static OGASYNCALLOCATIONCOUNTER_API bool IsInstalled();
+
+	//Allocations made by the calling thread since the proxy was installed
+	static OGASYNCALLOCATIONCOUNTER_API uint64 GetThreadAllocationCount();
+};
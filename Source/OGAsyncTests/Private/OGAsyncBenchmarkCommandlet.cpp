@@ -0,0 +1,50 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncBenchmarkCommandlet.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "OGAsyncBenchmarks.h"
+#include "OGFuture.h"
+
+UOGAsyncBenchmarkCommandlet::UOGAsyncBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOGAsyncBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString Filter;
+	FParse::Value(*Params, TEXT("Filter="), Filter);
+
+	double MinSeconds = 0.25;
+	FParse::Value(*Params, TEXT("MinSeconds="), MinSeconds);
+
+	FString OutputPath = FPaths::ProfilingDir() / TEXT("OGAsyncBenchmarks.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	if (!OGAsyncBenchmarks::CanCountAllocations()) [[unlikely]]
+	{
+		UE_LOG(LogOGFuture, Error, TEXT("Allocations can't be counted, run the commandlet with -OGAsyncCountAllocations"));
+		return 1;
+	}
+
+	//The commandlet stays alive for the whole run, so it can be the context every benchmark binds to
+	const TArray<FOGBenchmarkResult> Results = OGAsyncBenchmarks::Run(this, Filter, MinSeconds);
+	for (const FOGBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogOGFuture, Display, TEXT("%-32s %12.1f ns/op %8.2f allocs/op (%lld iterations)"), *Result.Name, Result.NsPerOp, Result.AllocsPerOp, Result.Iterations);
+	}
+
+	if (!FFileHelper::SaveStringToFile(OGAsyncBenchmarks::ToJson(Results), *OutputPath)) [[unlikely]]
+	{
+		UE_LOG(LogOGFuture, Error, TEXT("Could not write benchmark results to %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogOGFuture, Display, TEXT("Wrote %d benchmark results to %s"), Results.Num(), *OutputPath);
+	return 0;
+}
@@ -0,0 +1,24 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OGAsyncBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs the OGAsync microbenchmarks and writes the results as JSON, e.g.
+ * UnrealEditor-Cmd Project.uproject -run=OGAsyncBenchmark -OGAsyncCountAllocations -unattended -nullrhi [-Filter=Chain] [-MinSeconds=0.5] [-Output=Path.json]
+ * -OGAsyncCountAllocations is required, it installs the allocation counter before any worker thread starts.
+ * The output defaults to Saved/Profiling/OGAsyncBenchmarks.json.
+ */
+UCLASS()
+class UOGAsyncBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOGAsyncBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
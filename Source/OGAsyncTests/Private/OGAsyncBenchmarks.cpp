@@ -0,0 +1,304 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncBenchmarks.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+#include "OGAsyncAllocationCounterModule.h"
+#include "OGFutureBP.h"
+#include "OGFutureUtilities.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	//Benchmarks that need a live promise per iteration make them this many at a time, so setup stays bounded
+	constexpr int64 BatchSize = 1024;
+
+	typedef TFunction<void(int64 Iterations, FOGBenchmarkTimer& Timer)> FBenchmarkBody;
+
+	struct FBenchmark
+	{
+		FString Name;
+		FBenchmarkBody Body;
+		//How many operations one iteration performs, ns/op and allocations/op are per operation
+		int64 OpsPerIteration = 1;
+	};
+
+	//Doubles the iteration count until the measured part takes long enough to trust
+	FOGBenchmarkResult Measure(const FBenchmark& Benchmark, double MinSeconds)
+	{
+		constexpr int64 MaxIterations = int64(1) << 24;
+		int64 Iterations = 1;
+		FOGBenchmarkTimer Timer;
+		while (true)
+		{
+			Timer = FOGBenchmarkTimer();
+			Benchmark.Body(Iterations, Timer);
+			if (Timer.GetSeconds() >= MinSeconds || Iterations >= MaxIterations)
+				break;
+			Iterations *= 2;
+		}
+
+		const double Ops = static_cast<double>(Iterations * Benchmark.OpsPerIteration);
+		FOGBenchmarkResult Result;
+		Result.Name = Benchmark.Name;
+		Result.Iterations = Iterations;
+		Result.NsPerOp = Timer.GetSeconds() * 1e9 / Ops;
+		Result.AllocsPerOp = Timer.GetAllocations() / Ops;
+		return Result;
+	}
+
+	TArray<FBenchmark> MakeBenchmarks(UObject* Context)
+	{
+		TArray<FBenchmark> Benchmarks;
+
+		Benchmarks.Add({TEXT("Promise.CreateFulfillDestroy"), [](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			Timer.Start();
+			for (int64 Index = 0; Index < Iterations; ++Index)
+			{
+				TOGPromise<int32> Promise;
+				Promise->Fulfill(static_cast<int32>(Index));
+			}
+			Timer.Stop();
+		}});
+
+		Benchmarks.Add({TEXT("Promise.CreateDestroyUnfulfilled"), [](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			Timer.Start();
+			for (int64 Index = 0; Index < Iterations; ++Index)
+			{
+				TOGPromise<int32> Promise;
+			}
+			Timer.Stop();
+		}});
+
+		Benchmarks.Add({TEXT("WeakThen.Pending"), [Context](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			int32 Sum = 0;
+			TArray<TOGPromise<int32>> Promises;
+			Promises.Reserve(FMath::Min(Iterations, BatchSize));
+			for (int64 Done = 0; Done < Iterations; Done += BatchSize)
+			{
+				const int64 NumInBatch = FMath::Min(Iterations - Done, BatchSize);
+				for (int64 Index = 0; Index < NumInBatch; ++Index)
+				{
+					Promises.AddDefaulted();
+				}
+
+				Timer.Start();
+				for (TOGPromise<int32>& Promise : Promises)
+				{
+					Promise->WeakThen(Context, [&Sum](const int32& Value) { Sum += Value; });
+				}
+				Timer.Stop();
+
+				for (TOGPromise<int32>& Promise : Promises)
+				{
+					Promise->Fulfill(1);
+				}
+				Promises.Reset();
+			}
+		}});
+
+		Benchmarks.Add({TEXT("WeakThen.Fulfilled"), [Context](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			TOGPromise<int32> Promise;
+			Promise->Fulfill(1);
+
+			int32 Sum = 0;
+			Timer.Start();
+			for (int64 Index = 0; Index < Iterations; ++Index)
+			{
+				Promise->WeakThen(Context, [&Sum](const int32& Value) { Sum += Value; });
+			}
+			Timer.Stop();
+		}});
+
+		for (const int32 NumSubscribers : {0, 1, 16, 1024})
+		{
+			Benchmarks.Add({FString::Printf(TEXT("Fulfill.Subscribers.%d"), NumSubscribers), [Context, NumSubscribers](int64 Iterations, FOGBenchmarkTimer& Timer)
+			{
+				int32 Sum = 0;
+				TArray<TOGPromise<int32>> Promises;
+				Promises.Reserve(FMath::Min(Iterations, BatchSize));
+				for (int64 Done = 0; Done < Iterations; Done += BatchSize)
+				{
+					const int64 NumInBatch = FMath::Min(Iterations - Done, BatchSize);
+					for (int64 Index = 0; Index < NumInBatch; ++Index)
+					{
+						TOGPromise<int32>& Promise = Promises.AddDefaulted_GetRef();
+						for (int32 Subscriber = 0; Subscriber < NumSubscribers; ++Subscriber)
+						{
+							Promise->WeakThen(Context, [&Sum](const int32& Value) { Sum += Value; });
+						}
+					}
+
+					Timer.Start();
+					for (TOGPromise<int32>& Promise : Promises)
+					{
+						Promise->Fulfill(1);
+					}
+					Timer.Stop();
+					Promises.Reset();
+				}
+			}});
+		}
+
+		for (const int32 Depth : {1, 10, 100, 1000, 10000})
+		{
+			Benchmarks.Add({FString::Printf(TEXT("Chain.Depth.%d"), Depth), [Context, Depth](int64 Iterations, FOGBenchmarkTimer& Timer)
+			{
+				Timer.Start();
+				for (int64 Index = 0; Index < Iterations; ++Index)
+				{
+					TOGPromise<int32> Promise;
+					TOGFuture<int32> Tail = Promise;
+					for (int32 Link = 0; Link < Depth; ++Link)
+					{
+						Tail = Tail->WeakThen(Context, [](const int32&) {});
+					}
+					Promise->Fulfill(1);
+				}
+				Timer.Stop();
+			}});
+		}
+
+		for (const int32 NumInputs : {10, 1000, 100000})
+		{
+			for (const bool bAny : {false, true})
+			{
+				Benchmarks.Add({FString::Printf(TEXT("%s.Inputs.%d"), bAny ? TEXT("FutureAny") : TEXT("FutureAll"), NumInputs), [Context, NumInputs, bAny](int64 Iterations, FOGBenchmarkTimer& Timer)
+				{
+					for (int64 Index = 0; Index < Iterations; ++Index)
+					{
+						TArray<TOGPromise<void>> Promises;
+						TArray<FOGFuture> Futures;
+						Promises.Reserve(NumInputs);
+						Futures.Reserve(NumInputs);
+						for (int32 Input = 0; Input < NumInputs; ++Input)
+						{
+							Futures.Add(TOGFuture<void>(Promises.AddDefaulted_GetRef()));
+						}
+
+						Timer.Start();
+						const FOGFuture Combined = bAny ? UOGFutureUtilities::FutureAny(Context, Futures) : UOGFutureUtilities::FutureAll(Context, Futures);
+						for (TOGPromise<void>& Promise : Promises)
+						{
+							Promise->Fulfill();
+						}
+						Timer.Stop();
+						check(Combined->IsFulfilled());
+					}
+				}});
+			}
+		}
+
+		Benchmarks.Add({TEXT("Rejection.Propagation.Depth.100"), [Context](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			int32 NumCaught = 0;
+			for (int64 Index = 0; Index < Iterations; ++Index)
+			{
+				TOGPromise<int32> Promise;
+				TOGFuture<int32> Tail = Promise;
+				for (int32 Link = 0; Link < 100; ++Link)
+				{
+					Tail = Tail->WeakThen(Context, [](const int32&) {});
+				}
+				Tail->WeakCatch(Context, [&NumCaught](const FString&) { ++NumCaught; });
+
+				Timer.Start();
+				Promise->Throw(TEXT("Benchmark"));
+				Timer.Stop();
+			}
+		}});
+
+		Benchmarks.Add({TEXT("BP.Conversion"), [](int64 Iterations, FOGBenchmarkTimer& Timer)
+		{
+			Timer.Start();
+			for (int64 Index = 0; Index < Iterations; ++Index)
+			{
+				const FOGPromise Promise = UOGFutureBP::MakePromise<int32>();
+				const FOGFuture Generic = UOGFutureBP::ConvertToFuture(Promise);
+				const TOGFuture<int32> Future = Generic;
+				UOGFutureBP::FulfillPromise(Promise, static_cast<int32>(Index));
+				check(Future->IsFulfilled());
+			}
+			Timer.Stop();
+		}});
+
+		return Benchmarks;
+	}
+}
+
+void FOGBenchmarkTimer::Start()
+{
+	StartAllocations = OGAsyncBenchmarks::GetThreadAllocationCount();
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+void FOGBenchmarkTimer::Stop()
+{
+	TotalCycles += FPlatformTime::Cycles64() - StartCycles;
+	TotalAllocations += OGAsyncBenchmarks::GetThreadAllocationCount() - StartAllocations;
+}
+
+double FOGBenchmarkTimer::GetSeconds() const
+{
+	return FPlatformTime::ToSeconds64(TotalCycles);
+}
+
+bool OGAsyncBenchmarks::CanCountAllocations()
+{
+	return FOGAsyncAllocationCounterModule::IsInstalled();
+}
+
+uint64 OGAsyncBenchmarks::GetThreadAllocationCount()
+{
+	return FOGAsyncAllocationCounterModule::GetThreadAllocationCount();
+}
+
+TArray<FOGBenchmarkResult> OGAsyncBenchmarks::Run(UObject* Context, const FString& Filter, double MinSeconds)
+{
+	return Run(Context, [&Filter](const FString& Name) { return Filter.IsEmpty() || Name.Contains(Filter); }, MinSeconds);
+}
+
+TArray<FOGBenchmarkResult> OGAsyncBenchmarks::Run(UObject* Context, TFunctionRef<bool(const FString& Name)> ShouldRun, double MinSeconds)
+{
+	check(IsInGameThread());
+
+	TArray<FOGBenchmarkResult> Results;
+	for (const FBenchmark& Benchmark : MakeBenchmarks(Context))
+	{
+		if (ShouldRun(Benchmark.Name))
+		{
+			Results.Add(Measure(Benchmark, MinSeconds));
+		}
+	}
+	return Results;
+}
+
+FString OGAsyncBenchmarks::ToJson(const TArray<FOGBenchmarkResult>& Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	for (const FOGBenchmarkResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetStringField(TEXT("name"), Result.Name);
+		Entry->SetNumberField(TEXT("iterations"), static_cast<double>(Result.Iterations));
+		Entry->SetNumberField(TEXT("ns_per_op"), Result.NsPerOp);
+		Entry->SetNumberField(TEXT("allocs_per_op"), Result.AllocsPerOp);
+		Entries.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Root->SetArrayField(TEXT("benchmarks"), Entries);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Json;
+}
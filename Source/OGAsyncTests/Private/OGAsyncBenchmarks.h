@@ -0,0 +1,54 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FOGBenchmarkResult
+{
+	FString Name;
+	int64 Iterations = 0;
+	double NsPerOp = 0.0;
+	double AllocsPerOp = 0.0;
+};
+
+//Measures only the part of a benchmark between Start and Stop, so setup and teardown are left out
+class FOGBenchmarkTimer
+{
+public:
+	void Start();
+	void Stop();
+
+	double GetSeconds() const;
+	uint64 GetAllocations() const { return TotalAllocations; }
+
+private:
+	uint64 StartCycles = 0;
+	uint64 StartAllocations = 0;
+	uint64 TotalCycles = 0;
+	uint64 TotalAllocations = 0;
+};
+
+/**
+ * Microbenchmarks of the core future operations, reporting ns/op and allocations/op.
+ *
+ * Allocations are every heap allocation the game thread makes while a benchmark is being timed, counted by the proxy
+ * allocator in OGAsyncAllocationCounterModule.h. It is only installed when the process is started with
+ * -OGAsyncCountAllocations, without it allocations read as 0 and CanCountAllocations is false.
+ * Run headless with the OGAsyncBenchmark commandlet, which writes the results as JSON.
+ */
+namespace OGAsyncBenchmarks
+{
+	//Runs every benchmark whose name contains Filter, each repeated until it has been measured for at least MinSeconds
+	TArray<FOGBenchmarkResult> Run(UObject* Context, const FString& Filter = FString(), double MinSeconds = 0.25);
+
+	//Runs every benchmark ShouldRun accepts the name of
+	TArray<FOGBenchmarkResult> Run(UObject* Context, TFunctionRef<bool(const FString& Name)> ShouldRun, double MinSeconds = 0.25);
+
+	FString ToJson(const TArray<FOGBenchmarkResult>& Results);
+
+	bool CanCountAllocations();
+
+	//Allocations made by the calling thread so far
+	uint64 GetThreadAllocationCount();
+}
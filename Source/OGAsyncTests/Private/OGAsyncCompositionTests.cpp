@@ -0,0 +1,466 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "OGAsyncPool.h"
+#include "OGAsyncTestUtils.h"
+#include "OGAsyncValue.h"
+#include "OGFuture.h"
+#include "OGPipeline.h"
+#include "OGProgressFuture.h"
+#include "OGStartupSubsystem.h"
+#include "OGTaskGraph.h"
+#include "Tests/AutomationCommon.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncTaskGraphTest, "OccamsGamekit.OGAsync.Composition.TaskGraph",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncTaskGraphTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    // Test 1: Diamond graph runs independent nodes side by side and waits for both before the join
+    {
+        TOGPromise<void> PromiseA;
+        TOGPromise<void> PromiseB;
+        TArray<FName> Started;
+
+        TOGTaskGraphBuilder<> Graph;
+        Graph.AddNode("Root", [&Started]() { Started.Add("Root"); TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); });
+        Graph.AddNode("A", [&]() { Started.Add("A"); return TOGFuture<void>(PromiseA); }, {"Root"});
+        Graph.AddNode("B", [&]() { Started.Add("B"); return TOGFuture<void>(PromiseB); }, {"Root"});
+        Graph.AddNode("Join", [&Started]() { Started.Add("Join"); TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); }, {"A", "B"});
+
+        TOGFuture<TOGTaskGraphBuilder<>::FReport> Run = Graph.Run(ContextObject);
+        TestEqual(TEXT("Both branches should start as soon as the root resolves"), Started.Num(), 3);
+
+        PromiseB->Fulfill();
+        TestFalse(TEXT("Join should wait for every dependency"), Started.Contains("Join"));
+
+        PromiseA->Fulfill();
+        TestTrue(TEXT("Join should start once both branches resolve"), Started.Contains("Join"));
+        TestTrue(TEXT("Run should be fulfilled once every node resolves"), Run->IsFulfilled());
+
+        const TOGTaskGraphBuilder<>::FReport& Report = Run->GetValueSafe();
+        TestEqual(TEXT("Report should time every node"), Report.Nodes.Num(), 4);
+        TestEqual(TEXT("Critical path should go through the branch that resolved last"), Report.CriticalPath, TArray<FName>({"Root", "A", "Join"}));
+    }
+
+    // Test 2: Cycles are rejected before anything runs
+    {
+        bool NodeRan = false;
+        TOGTaskGraphBuilder<> Graph;
+        Graph.AddNode("A", [&NodeRan]() { NodeRan = true; return FOGFuture(); }, {"B"});
+        Graph.AddNode("B", [&NodeRan]() { NodeRan = true; return FOGFuture(); }, {"A"});
+
+        FString Error;
+        TestFalse(TEXT("Validate should detect the cycle"), Graph.Validate(&Error));
+        TestTrue(TEXT("Run should be rejected"), Graph.Run(ContextObject)->IsRejected());
+        TestFalse(TEXT("No node should run in a cyclic graph"), NodeRan);
+    }
+
+    // Test 3: A failing node stops its dependents and rejects the run
+    {
+        TOGPromise<void> PromiseA;
+        bool DependentRan = false;
+        TOGTaskGraphBuilder<> Graph;
+        Graph.AddNode("A", [&]() { return TOGFuture<void>(PromiseA); });
+        Graph.AddNode("B", [&DependentRan]() { DependentRan = true; return FOGFuture(); }, {"A"});
+
+        FString Reason;
+        TOGFuture<TOGTaskGraphBuilder<>::FReport> Run = Graph.Run(ContextObject);
+        Run->WeakCatch(ContextObject, [&Reason](const FString& InReason) { Reason = InReason; });
+
+        PromiseA->Throw(TEXT("Disk error"));
+        TestTrue(TEXT("Run should be rejected"), Run->IsRejected());
+        TestEqual(TEXT("Rejection should name the failing node"), Reason, FString(TEXT("Task graph node A failed: Disk error")));
+        TestFalse(TEXT("Dependents of a failed node should not run"), DependentRan);
+    }
+
+    // Test 4: Destroying the context mid run rejects it instead of leaving it pending
+    {
+        AActor* RunContext = World->SpawnActor<AActor>();
+        TOGPromise<void> PromiseA;
+        bool DependentRan = false;
+        TOGTaskGraphBuilder<> Graph;
+        Graph.AddNode("A", [&]() { return TOGFuture<void>(PromiseA); });
+        Graph.AddNode("B", [&DependentRan]() { DependentRan = true; TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); }, {"A"});
+
+        TOGFuture<TOGTaskGraphBuilder<>::FReport> Run = Graph.Run(RunContext);
+        RunContext->Destroy();
+
+        PromiseA->Fulfill();
+        TestTrue(TEXT("Run should be rejected once its context is gone"), Run->IsRejected());
+        TestFalse(TEXT("No node should start after the context is gone"), DependentRan);
+        TestTrue(TEXT("A run without a context should be rejected"), Graph.Run(nullptr)->IsRejected());
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncStartupSubsystemTest, "OccamsGamekit.OGAsync.Composition.Startup",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncStartupSubsystemTest::RunTest(const FString& Parameters)
+{
+    // The subsystem is driven by hand rather than through a live game instance, so each case gets a fresh uninitialised one
+    UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+    auto MakeStartup = [GameInstance]() { return NewObject<UOGStartupSubsystem>(GameInstance); };
+
+    IConsoleVariable* FrameBudget = IConsoleManager::Get().FindConsoleVariable(TEXT("OGAsync.Startup.FrameBudgetMs"));
+    const float PreviousFrameBudget = FrameBudget->GetFloat();
+    ON_SCOPE_EXIT{FrameBudget->Set(PreviousFrameBudget);};
+
+    // Test 1: Steps start in dependency order and the ready future resolves after the last one
+    {
+        UOGStartupSubsystem* Startup = MakeStartup();
+        TArray<FName> Started;
+        TOGPromise<void> PromiseA;
+        TOGPromise<void> PromiseB;
+        Startup->AddStep("A", [&]() { Started.Add("A"); return TOGFuture<void>(PromiseA); });
+        Startup->AddStep("B", [&]() { Started.Add("B"); return TOGFuture<void>(PromiseB); }, {"A"});
+
+        Startup->Tick(0.f);
+        TestTrue(TEXT("Startup should have begun on the first tick"), Startup->HasStarted());
+        TestTrue(TEXT("Only the step without dependencies should start"), Started.Num() == 1 && Started[0] == "A");
+
+        PromiseA->Fulfill();
+        Startup->Tick(0.f);
+        TestTrue(TEXT("Dependent should start once its dependency resolves"), Started.Num() == 2 && Started[1] == "B");
+        TestTrue(TEXT("Ready future should wait for every step"), Startup->GetReadyFuture()->IsPending());
+
+        PromiseB->Fulfill();
+        Startup->Tick(0.f);
+        TestTrue(TEXT("Ready future should resolve after the last step"), Startup->GetReadyFuture()->IsFulfilled());
+
+        UOGStartupSubsystem::FTimeline Timeline;
+        TestTrue(TEXT("Timeline should be available"), Startup->GetTimeline()->TryGetValue(Timeline));
+        TestEqual(TEXT("Timeline should contain every step"), Timeline.Nodes.Num(), 2);
+    }
+
+    // Test 2: A zero frame budget starts one game thread step per tick
+    {
+        FrameBudget->Set(0.f);
+        UOGStartupSubsystem* Startup = MakeStartup();
+        int32 NumStarted = 0;
+        for (const FName Name : {FName("A"), FName("B"), FName("C")})
+        {
+            Startup->AddStep(Name, [&NumStarted]() { ++NumStarted; TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); });
+        }
+
+        Startup->Tick(0.f);
+        TestEqual(TEXT("First slice should start one step"), NumStarted, 1);
+        Startup->Tick(0.f);
+        TestEqual(TEXT("Second slice should start one more"), NumStarted, 2);
+        Startup->Tick(0.f);
+        TestEqual(TEXT("Third slice should start the last"), NumStarted, 3);
+        TestTrue(TEXT("Ready future should resolve once the slices are done"), Startup->GetReadyFuture()->IsFulfilled());
+        FrameBudget->Set(PreviousFrameBudget);
+    }
+
+    // Test 3: Worker steps run off the game thread and gate their game thread dependents
+    {
+        UOGStartupSubsystem* Startup = MakeStartup();
+        std::atomic<bool> bRanOnWorker = false;
+        bool bDependentStarted = false;
+        Startup->AddWorkerStep("Work", [&bRanOnWorker]() { bRanOnWorker = !IsInGameThread(); });
+        Startup->AddStep("AfterWork", [&bDependentStarted]() { bDependentStarted = true; TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); }, {"Work"});
+
+        const bool bReady = OGAsyncTests::WaitUntil([Startup]() { Startup->Tick(0.f); return !Startup->GetReadyFuture()->IsPending(); });
+        TestTrue(TEXT("Startup should finish"), bReady && Startup->GetReadyFuture()->IsFulfilled());
+        TestTrue(TEXT("Worker step should run off the game thread"), bRanOnWorker.load());
+        TestTrue(TEXT("Dependent of the worker step should run"), bDependentStarted);
+    }
+
+    // Test 4: A failing step rejects startup and queued steps are never started
+    {
+        FrameBudget->Set(0.f);
+        UOGStartupSubsystem* Startup = MakeStartup();
+        bool bQueuedStarted = false;
+        bool bDependentStarted = false;
+        Startup->AddStep("Fails", []() { TOGPromise<void> Failed; Failed->Throw(TEXT("Missing config")); return TOGFuture<void>(Failed); });
+        Startup->AddStep("Queued", [&bQueuedStarted]() { bQueuedStarted = true; TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); });
+        Startup->AddStep("Dependent", [&bDependentStarted]() { bDependentStarted = true; TOGPromise<void> Done; Done->Fulfill(); return TOGFuture<void>(Done); }, {"Fails"});
+
+        FString Reason;
+        Startup->GetReadyFuture()->WeakCatch(GameInstance, [&Reason](const FString& InReason) { Reason = InReason; });
+        Startup->Tick(0.f);
+        Startup->Tick(0.f);
+        TestTrue(TEXT("Ready future should be rejected"), Startup->GetReadyFuture()->IsRejected());
+        TestTrue(TEXT("Timeline should be rejected"), Startup->GetTimeline()->IsRejected());
+        TestTrue(TEXT("Rejection should carry the step's reason"), Reason.Contains(TEXT("Missing config")));
+        TestFalse(TEXT("Steps queued behind the failure should not start"), bQueuedStarted);
+        TestFalse(TEXT("Dependents of the failed step should not start"), bDependentStarted);
+        FrameBudget->Set(PreviousFrameBudget);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncPipelineTest, "OccamsGamekit.OGAsync.Composition.Pipeline",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncPipelineTest::RunTest(const FString& Parameters)
+{
+    // Test 1: A slow stage applies backpressure to the stages in front of it
+    {
+        TArray<TOGPromise<int32>> SlowPromises;
+        TOGPipeline<int32> Pipeline = TOGPipeline<int32>::Create([](int32 Value) { return Value * 2; }, {1, 2})
+            .AddStage([&SlowPromises](int32 Value)
+            {
+                //Held in the array, a promise destroyed while pending would reject its future
+                TOGPromise<int32>& Promise = SlowPromises.AddDefaulted_GetRef();
+                return TOGFuture<int32>(Promise);
+            }, {1, 1});
+
+        TArray<TOGFuture<int32>> Results;
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            TestTrue(FString::Printf(TEXT("Item %d should fit in the pipeline"), Index), Pipeline.TryPush(Index, Results.AddDefaulted_GetRef()));
+        }
+        TOGFuture<int32> Rejected;
+        TestFalse(TEXT("Push should fail once every queue is full"), Pipeline.TryPush(4, Rejected));
+        TestEqual(TEXT("Slow stage should only work on one item at once"), SlowPromises.Num(), 1);
+
+        bool HasCapacity = false;
+        Pipeline.WaitForCapacity()->Then(TOGFutureState<void>::FThenDelegate::CreateLambda([&HasCapacity]() { HasCapacity = true; }));
+
+        SlowPromises[0]->Fulfill(100);
+        TestEqual(TEXT("First item should resolve with the last stage's result"), Results[0]->GetValueSafe(), 100);
+        TestEqual(TEXT("Slow stage should start the next item"), SlowPromises.Num(), 2);
+        TestTrue(TEXT("Capacity should free up as items move on"), HasCapacity);
+    }
+
+    // Test 2: Rejections reach the item's future, and completion waits for every accepted item
+    {
+        TArray<TOGPromise<int32>> Promises;
+        TOGPipeline<int32> Pipeline = TOGPipeline<int32>::Create([&Promises](int32 Value)
+        {
+            TOGPromise<int32>& Promise = Promises.AddDefaulted_GetRef();
+            return TOGFuture<int32>(Promise);
+        }, {2});
+
+        TOGFuture<int32> First, Second;
+        Pipeline.TryPush(1, First);
+        Pipeline.TryPush(2, Second);
+        TOGFuture<void> Complete = Pipeline.Close();
+        TOGFuture<int32> Late;
+        TestFalse(TEXT("Closed pipeline should not accept items"), Pipeline.TryPush(3, Late));
+
+        Promises[0]->Throw(TEXT("Corrupt"));
+        TestTrue(TEXT("Item should be rejected with its stage"), First->IsRejected());
+        TestTrue(TEXT("Completion should wait for the remaining item"), Complete->IsPending());
+
+        Promises[1]->Fulfill(2);
+        TestTrue(TEXT("Completion should resolve once every item has left"), Complete->IsFulfilled());
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncPoolTest, "OccamsGamekit.OGAsync.Composition.Pool",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncPoolTest::RunTest(const FString& Parameters)
+{
+    typedef TOGAsyncPool<int32>::FHandle FHandle;
+
+    // Test 1: Acquire grows up to MaxSize, then waits in FIFO order for releases
+    {
+        int32 NumCreated = 0;
+        TSharedRef<TOGAsyncPool<int32>> Pool = MakeShared<TOGAsyncPool<int32>>(FOGAsyncPoolPolicy{0, 2, 1, false},
+            [&NumCreated]() { return NumCreated++; });
+
+        TOGFuture<FHandle> First = Pool->Acquire();
+        TOGFuture<FHandle> Second = Pool->Acquire();
+        TOGFuture<FHandle> Third = Pool->Acquire();
+        TOGFuture<FHandle> Fourth = Pool->Acquire();
+        TestTrue(TEXT("Items should be handed out while the pool can grow"), First->IsFulfilled() && Second->IsFulfilled());
+        TestTrue(TEXT("Acquire should wait once the pool is at MaxSize"), Third->IsPending() && Fourth->IsPending());
+        TestEqual(TEXT("Pool should never create more than MaxSize items"), NumCreated, 2);
+
+        const int32 SecondItem = *Second->GetValueSafe();
+        Second = TOGFuture<FHandle>();
+        TestTrue(TEXT("The first waiter should get the released item"), Third->IsFulfilled() && Fourth->IsPending());
+        TestEqual(TEXT("Released item should be reused"), *Third->GetValueSafe(), SecondItem);
+    }
+
+    // Test 2: Batched releases only become available once flushed
+    {
+        TSharedRef<TOGAsyncPool<int32>> Pool = MakeShared<TOGAsyncPool<int32>>(FOGAsyncPoolPolicy{1, 1},
+            []() { return 7; }, [](int32& Item) { Item = 0; });
+
+        FHandle Handle;
+        TestTrue(TEXT("Initial item should be free"), Pool->TryAcquire(Handle));
+        TOGFuture<FHandle> Waiting = Pool->Acquire();
+
+        Handle.Reset();
+        TestTrue(TEXT("Release should wait for the end of the frame"), Waiting->IsPending());
+
+        Pool->FlushReleases();
+        TestTrue(TEXT("Flushed release should serve the waiter"), Waiting->IsFulfilled());
+        TestEqual(TEXT("Released item should have been reset"), *Waiting->GetValueSafe(), 0);
+    }
+
+    // Test 3: Shrink destroys the coldest free items and keeps the ones Acquire would reuse next
+    {
+        int32 NextItem = 0;
+        TSharedRef<TOGAsyncPool<int32>> Pool = MakeShared<TOGAsyncPool<int32>>(FOGAsyncPoolPolicy{3, 3},
+            [&NextItem]() { return NextItem++; });
+
+        Pool->Shrink(1);
+        TestEqual(TEXT("Shrink should leave the requested number of items"), Pool->GetNumFree(), 1);
+        TestEqual(TEXT("Shrink should forget the destroyed items"), Pool->GetNumCreated(), 1);
+
+        FHandle Handle;
+        TestTrue(TEXT("Kept item should be free"), Pool->TryAcquire(Handle));
+        TestEqual(TEXT("Shrink should keep the warmest item"), *Handle, 2);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncValueTest, "OccamsGamekit.OGAsync.Composition.AsyncValue",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncValueTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    // Test 1: Derived values are computed lazily, and only when an input they depend on changed
+    {
+        int32 NumSumComputes = 0;
+        int32 NumSignComputes = 0;
+        TOGAsyncValue<int32> A = TOGAsyncValue<int32>::MakeInput(1);
+        TOGAsyncValue<int32> B = TOGAsyncValue<int32>::MakeInput(2);
+        TOGAsyncValue<int32> Sum = OGAsync::Derive([&NumSumComputes](const int32& InA, const int32& InB) { NumSumComputes++; return InA + InB; }, A, B);
+        TOGAsyncValue<bool> IsPositive = OGAsync::Derive([&NumSignComputes](const int32& InSum) { NumSignComputes++; return InSum > 0; }, Sum);
+
+        TestEqual(TEXT("Nothing should be computed until it is needed"), NumSumComputes, 0);
+        TestTrue(TEXT("Derived value should be computed on Get"), IsPositive.Get());
+        TestEqual(TEXT("Dependency should be computed once"), NumSumComputes, 1);
+
+        A.Set(5);
+        A.Set(6);
+        TestEqual(TEXT("Setting an input should not recompute anything yet"), NumSumComputes, 1);
+        TestEqual(TEXT("Sum should pick up the latest input"), Sum.Get(), 8);
+        TestEqual(TEXT("Several changes should cause a single recompute"), NumSumComputes, 2);
+
+        TestTrue(TEXT("Sign should still be positive"), IsPositive.Get());
+        TestEqual(TEXT("Sign was recomputed because its dependency changed"), NumSignComputes, 2);
+
+        A.Set(7);
+        B.Set(1);
+        IsPositive.Get();
+        TestEqual(TEXT("Sum should be recomputed"), NumSumComputes, 3);
+        TestEqual(TEXT("Sum came out unchanged, so its dependents should not be recomputed"), NumSignComputes, 2);
+    }
+
+    // Test 2: Subscribers are notified once per flush, and only when the value changed
+    {
+        TOGAsyncValue<int32> Input = TOGAsyncValue<int32>::MakeInput(0);
+        TOGAsyncValue<int32> Doubled = OGAsync::Derive([](const int32& Value) { return Value * 2; }, Input);
+        Doubled.Get();
+
+        TArray<int32> Notifications;
+        Doubled.Subscribe(ContextObject, [&Notifications](const int32& Value) { Notifications.Add(Value); });
+
+        Input.Set(1);
+        Input.Set(2);
+        FOGAsyncCell::FlushNotifications();
+        TestEqual(TEXT("Subscriber should be notified once with the latest value"), Notifications, TArray<int32>({4}));
+
+        Input.Set(2);
+        FOGAsyncCell::FlushNotifications();
+        TestEqual(TEXT("Setting the same value should not notify"), Notifications.Num(), 1);
+    }
+
+    // Test 3: Inputs can be set from futures
+    {
+        TOGPromise<int32> Promise;
+        TOGAsyncValue<int32> Input = TOGAsyncValue<int32>::FromFuture(Promise, -1);
+        TestEqual(TEXT("Input should hold its initial value until the future resolves"), Input.Get(), -1);
+        Promise->Fulfill(42);
+        TestEqual(TEXT("Input should take the future's value"), Input.Get(), 42);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncProgressTest, "OccamsGamekit.OGAsync.Composition.Progress",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncProgressTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    // Test 1: Many progress reports are coalesced into one notification per flush
+    {
+        TOGProgressPromise<int32> Promise;
+        TOGProgressFuture<int32> Future = Promise.GetFuture();
+        TArray<float> Notifications;
+        Future.OnProgress(ContextObject, [&Notifications](float Progress) { Notifications.Add(Progress); });
+
+        for (int32 Index = 1; Index <= 1000; ++Index)
+        {
+            Promise.SetProgress(Index / 2000.f);
+        }
+        FOGProgressChannel::FlushNotifications();
+        TestEqual(TEXT("Subscriber should be notified once"), Notifications.Num(), 1);
+        TestEqual(TEXT("Notification should carry the latest progress"), Notifications.Last(), 0.5f);
+
+        FOGProgressChannel::FlushNotifications();
+        TestEqual(TEXT("Nothing changed, so nothing should be notified"), Notifications.Num(), 1);
+
+        Promise.Fulfill(3);
+        TestEqual(TEXT("Fulfilling should report full progress"), Future.GetProgress(), 1.f);
+        TestTrue(TEXT("Future should be fulfilled"), Future->IsFulfilled());
+    }
+
+    // Test 2: FutureAll aggregates weighted progress and counts resolved futures as done
+    {
+        TOGProgressPromise<int32> Heavy;
+        TOGProgressPromise<void> Light;
+        TOGProgressFuture<void> All = OGAsync::FutureAll(ContextObject, {Heavy.GetFuture(), Light.GetFuture()}, {3.f, 1.f});
+
+        Heavy.SetProgress(0.5f);
+        FOGProgressChannel::FlushNotifications();
+        TestEqual(TEXT("Composite progress should be the weighted average"), All.GetProgress(), 0.375f);
+
+        Light.Fulfill();
+        FOGProgressChannel::FlushNotifications();
+        TestEqual(TEXT("Resolved futures should count as done"), All.GetProgress(), 0.625f);
+        TestTrue(TEXT("Composite should wait for every future"), All->IsPending());
+
+        Heavy.Fulfill(1);
+        FOGProgressChannel::FlushNotifications();
+        TestTrue(TEXT("Composite should resolve once every future resolves"), All->IsFulfilled());
+        TestEqual(TEXT("Composite should reach full progress"), All.GetProgress(), 1.f);
+    }
+
+    return true;
+}
@@ -0,0 +1,302 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "OGAsyncLatency.h"
+#include "OGAsyncMemory.h"
+#include "OGAsyncPending.h"
+#include "OGFuture.h"
+#include "Tests/AutomationCommon.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncLatencyTest, "OccamsGamekit.OGAsync.Diagnostics.Latency",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncLatencyTest::RunTest(const FString& Parameters)
+{
+    // Test 1: Buckets are exact for small values and within the advertised error above that
+    {
+        for (const uint64 Value : {0ull, 7ull, 15ull})
+        {
+            TestEqual(TEXT("Small values should have a bucket each"), FOGLatencyHistogram::GetBucketValue(FOGLatencyHistogram::GetBucketIndex(Value)), Value);
+        }
+        for (const uint64 Value : {16ull, 100ull, 4321ull, 1000000ull, 987654321ull})
+        {
+            const uint64 BucketValue = FOGLatencyHistogram::GetBucketValue(FOGLatencyHistogram::GetBucketIndex(Value));
+            TestTrue(FString::Printf(TEXT("Bucket for %llu should be within 7%%, got %llu"), Value, BucketValue), FMath::Abs(double(BucketValue) - double(Value)) <= Value * 0.07);
+        }
+        TestEqual(TEXT("Huge values should land in the last bucket"), FOGLatencyHistogram::GetBucketIndex(MAX_uint64), FOGLatencyHistogram::NumBuckets - 1);
+    }
+
+    // Test 2: Percentiles are read from the merged counts
+    {
+        FOGLatencyHistogram Histogram;
+        for (int32 Index = 0; Index < 99; ++Index)
+        {
+            Histogram.Record(10);
+        }
+        Histogram.Record(5000);
+
+        TArray<uint64> Counts;
+        Counts.SetNumZeroed(FOGLatencyHistogram::NumBuckets);
+        Histogram.MergeInto(Counts);
+        TestEqual(TEXT("p50 should be the common value"), FOGLatencyHistogram::GetPercentile(Counts, 0.5), 10ull);
+        TestEqual(TEXT("p99 should still be the common value"), FOGLatencyHistogram::GetPercentile(Counts, 0.99), 10ull);
+        TestTrue(TEXT("p100 should be the outlier"), FOGLatencyHistogram::GetPercentile(Counts, 1.0) > 4500ull);
+        TestEqual(TEXT("Max should be exact"), Histogram.GetMaxMicroseconds(), 5000ull);
+    }
+
+    // Test 3: Promises made with a call site are recorded under it, whether they are fulfilled or rejected
+    {
+        static const FName CallSiteName(TEXT("OGAsyncTests.Latency"));
+        OGAsync::ResetLatencyHistograms();
+        {
+            TOGPromise<int32> Fulfilled{FOGCallSite(CallSiteName)};
+            TOGPromise<void> Rejected{FOGCallSite(CallSiteName)};
+            TOGPromise<int32> Untagged;
+            Fulfilled->Fulfill(1);
+            Rejected->Throw(TEXT("Failed"));
+            Untagged->Fulfill(2);
+        }
+
+        const TArray<FOGLatencySummary> Summaries = OGAsync::GetLatencySummaries();
+        const FOGLatencySummary* Summary = Summaries.FindByPredicate([](const FOGLatencySummary& Candidate) { return Candidate.CallSite == CallSiteName.ToString(); });
+        if (TestNotNull(TEXT("Call site should have a summary"), Summary))
+        {
+            TestEqual(TEXT("Both tagged promises should be recorded"), Summary->Count, 2ull);
+        }
+    }
+
+    // Test 4: Macro call sites look their histogram up once and reuse it afterwards
+    {
+        OGAsync::ResetLatencyHistograms();
+        const FOGCallSite* FirstSite = nullptr;
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            const FOGCallSite& Site = OGASYNC_NAMED_CALL_SITE("OGAsyncTests.CachedLatency");
+            TestTrue(TEXT("Every pass should use the same static call site"), !FirstSite || FirstSite == &Site);
+            FirstSite = &Site;
+
+            TOGPromise<int32> Promise{Site};
+            TestNotNull(TEXT("The site should have cached its histogram"), Site.CachedHistogram->load());
+            Promise->Fulfill(Index);
+        }
+
+        const TArray<FOGLatencySummary> Summaries = OGAsync::GetLatencySummaries();
+        const FOGLatencySummary* Summary = Summaries.FindByPredicate([](const FOGLatencySummary& Candidate) { return Candidate.CallSite == TEXT("OGAsyncTests.CachedLatency"); });
+        if (TestNotNull(TEXT("Cached call site should have a summary"), Summary))
+        {
+            TestEqual(TEXT("Every promise should be recorded through the cached histogram"), Summary->Count, 3ull);
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncPendingTest, "OccamsGamekit.OGAsync.Diagnostics.Pending",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncPendingTest::RunTest(const FString& Parameters)
+{
+#if OGASYNC_TRACK_PENDING
+    // Tracking is off by default, only states created while it is on are listed
+    IConsoleVariable* TrackPending = IConsoleManager::Get().FindConsoleVariable(TEXT("OGAsync.TrackPending"));
+    const bool bPreviousTrackPending = TrackPending->GetBool();
+    TrackPending->Set(true);
+    ON_SCOPE_EXIT{TrackPending->Set(bPreviousTrackPending);};
+
+    static const FName CallSiteName(TEXT("OGAsyncTests.Pending"));
+    const auto FindTracked = [](bool bWidestFirst) -> TOptional<FOGPendingFutureInfo>
+    {
+        for (const FOGPendingFutureInfo& Info : OGAsync::GetPendingFutures(MAX_int32, bWidestFirst))
+        {
+            if (Info.CallSite == CallSiteName.ToString())
+                return Info;
+        }
+        return TOptional<FOGPendingFutureInfo>();
+    };
+
+    // Test 1: A pending promise is listed with its call site and subscribers, and drops out once it resolves
+    {
+        TOGPromise<int32> Promise{FOGCallSite(CallSiteName)};
+        Promise->Then(TOGFutureState<int32>::FThenDelegate::CreateLambda([](const int32&) {}));
+        Promise->Catch(FOGFutureState::FCatchDelegate::CreateLambda([](const FString&) {}));
+
+        const TOptional<FOGPendingFutureInfo> Tracked = FindTracked(false);
+        if (TestTrue(TEXT("Pending promise should be listed"), Tracked.IsSet()))
+        {
+            TestEqual(TEXT("Then and Catch should both count as subscribers"), Tracked->NumSubscribers, 2);
+            TestTrue(TEXT("Age should be measured from creation"), Tracked->AgeSeconds >= 0.0);
+        }
+        TestTrue(TEXT("Sorting by subscribers should still list it"), FindTracked(true).IsSet());
+
+        Promise->Fulfill(1);
+        TestFalse(TEXT("Resolved promise should no longer be listed"), FindTracked(false).IsSet());
+    }
+
+    // Test 2: States destroyed while pending leave the registry too
+    {
+        const int32 NumBefore = OGAsync::GetNumPendingFutures();
+        {
+            TSharedRef<TOGFutureState<int32>> State = MakeShared<TOGFutureState<int32>>();
+            TestEqual(TEXT("New state should be tracked"), OGAsync::GetNumPendingFutures(), NumBefore + 1);
+        }
+        TestEqual(TEXT("Destroyed state should be untracked"), OGAsync::GetNumPendingFutures(), NumBefore);
+    }
+
+    // Test 3: States created while tracking is off are never listed, even once it is turned back on
+    {
+        TrackPending->Set(false);
+        TOGPromise<int32> Untracked{FOGCallSite(CallSiteName)};
+        TrackPending->Set(true);
+        TestFalse(TEXT("State created with tracking off should not be listed"), FindTracked(false).IsSet());
+        Untracked->Fulfill(1);
+    }
+
+    // Test 4: States created on several threads at once are all counted
+    {
+        const int32 NumBefore = OGAsync::GetNumPendingFutures();
+        TArray<TSharedPtr<TOGFutureState<int32>>> States;
+        States.SetNum(64);
+        ParallelFor(States.Num(), [&States](int32 Index)
+        {
+            States[Index] = MakeShared<TOGFutureState<int32>>();
+        });
+        TestEqual(TEXT("Every state should be tracked"), OGAsync::GetNumPendingFutures(), NumBefore + States.Num());
+
+        States.Empty();
+        TestEqual(TEXT("Every state should be untracked"), OGAsync::GetNumPendingFutures(), NumBefore);
+    }
+#endif
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncMemoryTest, "OccamsGamekit.OGAsync.Diagnostics.Memory",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncMemoryTest::RunTest(const FString& Parameters)
+{
+#if OGASYNC_TRACK_MEMORY
+    const FString TypeName(typeid(TArray<int32>).name());
+    const auto FindType = [&TypeName]()
+    {
+        FOGAsyncMemoryReport::FStateType Found;
+        for (const FOGAsyncMemoryReport::FStateType& Type : OGAsync::GetMemoryReport().StateTypes)
+        {
+            if (Type.TypeName == TypeName)
+                Found = Type;
+        }
+        return Found;
+    };
+
+    // Test 1: Live states and the heap memory of their values are counted per type, and released with the states
+    {
+        const FOGAsyncMemoryReport::FStateType Before = FindType();
+        {
+            TArray<TOGPromise<TArray<int32>>> Promises;
+            for (int32 Index = 0; Index < 3; ++Index)
+            {
+                TArray<int32> Value;
+                Value.SetNumZeroed(100);
+                Promises.AddDefaulted_GetRef()->Fulfill(MoveTemp(Value));
+            }
+
+            const FOGAsyncMemoryReport::FStateType During = FindType();
+            TestEqual(TEXT("Live states should be counted"), During.NumLive - Before.NumLive, 3ll);
+            TestTrue(TEXT("Value heap memory should be counted"), During.PayloadBytes - Before.PayloadBytes >= 3 * 100 * static_cast<int64>(sizeof(int32)));
+        }
+        const FOGAsyncMemoryReport::FStateType After = FindType();
+        TestEqual(TEXT("Destroyed states should be released"), After.NumLive, Before.NumLive);
+        TestEqual(TEXT("Value memory should be released"), After.PayloadBytes, Before.PayloadBytes);
+    }
+
+    // Test 2: Callback storage is counted while the state is pending, and released when it resolves
+    {
+        const int64 Before = OGAsync::GetMemoryReport().CallbackBytes;
+        TOGPromise<int32> Promise;
+        Promise->Then(TOGFutureState<int32>::FThenDelegate::CreateLambda([](const int32&) {}));
+        TestTrue(TEXT("Pending callbacks should be counted"), OGAsync::GetMemoryReport().CallbackBytes > Before);
+        Promise->Fulfill(1);
+        TestEqual(TEXT("Callback storage should be released once dispatched"), OGAsync::GetMemoryReport().CallbackBytes, Before);
+    }
+#endif
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncCausalChainTest, "OccamsGamekit.OGAsync.Diagnostics.CausalChain",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncCausalChainTest::RunTest(const FString& Parameters)
+{
+#if OGASYNC_CAUSAL_CHAINS
+    const bool bWasCapturing = OGAsync::Private::bCaptureCausalChains;
+
+    // Test 1: Continuations link back through every Then to the promise that started the chain
+    {
+        OGAsync::Private::bCaptureCausalChains = true;
+        TOGPromise<int32> Promise{FOGCallSite(FName(TEXT("OGAsyncTests.CausalRoot")))};
+        TOGFuture<int32> First = Promise->Then(TOGFutureState<int32>::FThenDelegate::CreateLambda([](const int32&) {}));
+        TOGFuture<int32> Second = First->Then(TOGFutureState<int32>::FThenDelegate::CreateLambda([](const int32&) {}));
+
+        const FString Chain = Second->DescribeCausalChain();
+        TestTrue(TEXT("Chain should reach the root call site"), Chain.Contains(TEXT("OGAsyncTests.CausalRoot")));
+
+        int32 NumLinks = 0;
+        for (int32 Index = Chain.Find(TEXT("continuing")); Index != INDEX_NONE; Index = Chain.Find(TEXT("continuing"), ESearchCase::IgnoreCase, ESearchDir::FromStart, Index + 1))
+        {
+            ++NumLinks;
+        }
+        TestEqual(TEXT("Chain should have one link per Then"), NumLinks, 2);
+        TestFalse(TEXT("OGAsync's own frames should be left out"), Chain.Contains(TEXT("TOGFutureState")) || Chain.Contains(TEXT("FOGFutureState::")));
+        Promise->Fulfill(1);
+    }
+
+    // Test 2: Rejections are queued rather than symbolicated when the Catch fires, and logged when flushed
+    {
+        OGAsync::Private::FlushCausalReports();
+        AddExpectedMessage(TEXT("Causal test rejection"), EAutomationExpectedErrorFlags::Contains, 1);
+        TOGPromise<int32> Promise;
+        Promise->Catch(FOGFutureState::FCatchDelegate::CreateLambda([](const FString&) {}));
+        Promise->Throw(TEXT("Causal test rejection"));
+        TestEqual(TEXT("Rejection should be queued"), OGAsync::Private::GetNumQueuedCausalReports(), 1);
+
+        TestEqual(TEXT("Flushing should log the queued rejection"), OGAsync::Private::FlushCausalReports(), 1);
+        TestEqual(TEXT("Flushing should empty the queue"), OGAsync::Private::GetNumQueuedCausalReports(), 0);
+    }
+
+    // Test 3: A rejection passed on through several transforms is reported once, where it was thrown
+    {
+        AddExpectedMessage(TEXT("Causal transform rejection"), EAutomationExpectedErrorFlags::Contains, 1);
+        UObject* Context = GetTransientPackage();
+        TOGPromise<int32> Promise;
+        TOGFuture<int32> Tail = Promise;
+        for (int32 Index = 0; Index < 8; ++Index)
+        {
+            Tail = Tail->WeakThen<int32>(Context, [](const int32& Value) { return Value + 1; });
+        }
+        bool bCaught = false;
+        Tail->Catch(FOGFutureState::FCatchDelegate::CreateLambda([&bCaught](const FString&) { bCaught = true; }));
+
+        Promise->Throw(TEXT("Causal transform rejection"));
+        TestTrue(TEXT("Rejection should reach the end of the chain"), bCaught);
+        TestEqual(TEXT("Rejection should be queued once"), OGAsync::Private::GetNumQueuedCausalReports(), 1);
+        OGAsync::Private::FlushCausalReports();
+    }
+
+    // Test 4: Nothing is captured while the mode is off
+    {
+        OGAsync::Private::bCaptureCausalChains = false;
+        TOGPromise<int32> Promise;
+        TestTrue(TEXT("Chain should be empty when capture is off"), Promise->DescribeCausalChain().IsEmpty());
+        Promise->Fulfill(1);
+    }
+
+    OGAsync::Private::bCaptureCausalChains = bWasCapturing;
+#endif
+
+    return true;
+}
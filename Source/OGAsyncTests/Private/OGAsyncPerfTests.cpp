@@ -0,0 +1,160 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "OGAsyncBenchmarks.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Tests/AutomationCommon.h"
+
+namespace
+{
+    struct FBaselineEntry
+    {
+        double NsPerOp = 0.0;
+        double AllocsPerOp = 0.0;
+        double NsTolerance = 0.0;
+        double AllocsTolerance = 0.0;
+    };
+
+    // Timings are noisy, so each benchmark runs a few times and the best run is compared
+    constexpr int32 NumRuns = 3;
+    constexpr double MinSecondsPerRun = 0.1;
+
+    // Used when the baseline doesn't set its own, so the commandlet's output can be checked in as it is
+    constexpr double DefaultNsTolerance = 0.5;
+    constexpr double DefaultAllocsTolerance = 0.1;
+
+    // Allocation counts are averaged over the iterations, so allow a fraction of an allocation for amortised array growth
+    constexpr double AllocsSlack = 0.05;
+}
+
+// The benchmarks in Resources/OGAsyncPerfBaseline.json must not get slower or allocate more than its tolerance bands allow.
+// Tolerances are fractions of the baseline, set for the whole file and optionally per benchmark. The baseline is the
+// OGAsyncBenchmark commandlet's output on the reference machine, checked in as it is, and is only enforced on the platform
+// and configuration it was measured on. A missing baseline fails the test. A failing run writes its results to
+// Saved/Profiling/OGAsyncPerf.json.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncPerfBaselineTest, "OccamsGamekit.OGAsync.Perf.Baseline",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FOGAsyncPerfBaselineTest::RunTest(const FString& Parameters)
+{
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("OGAsync"));
+    if (!TestNotNull(TEXT("OGAsync plugin should be loaded"), Plugin.Get()))
+        return false;
+
+    const FString BaselinePath = Plugin->GetBaseDir() / TEXT("Resources/OGAsyncPerfBaseline.json");
+    FString BaselineText;
+    TSharedPtr<FJsonObject> Baseline;
+    if (!TestTrue(FString::Printf(TEXT("Perf baseline should be checked in at %s, generate it on the reference machine with -run=OGAsyncBenchmark -OGAsyncCountAllocations -Output=<that path>"), *BaselinePath),
+        FPaths::FileExists(BaselinePath)))
+        return false;
+    if (!TestTrue(FString::Printf(TEXT("Baseline should be readable at %s"), *BaselinePath), FFileHelper::LoadFileToString(BaselineText, *BaselinePath)))
+        return false;
+    if (!TestTrue(TEXT("Baseline should be valid JSON"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineText), Baseline) && Baseline.IsValid()))
+        return false;
+
+    // Timings from another platform or build configuration say nothing about this one
+    const FString Platform = FPlatformProperties::IniPlatformName();
+    const FString Configuration = LexToString(FApp::GetBuildConfiguration());
+    const FString BaselinePlatform = Baseline->GetStringField(TEXT("platform"));
+    const FString BaselineConfiguration = Baseline->GetStringField(TEXT("configuration"));
+    if (BaselinePlatform != Platform || BaselineConfiguration != Configuration)
+    {
+        AddWarning(FString::Printf(TEXT("Skipping, the perf baseline was measured on %s %s and this is %s %s"),
+            *BaselinePlatform, *BaselineConfiguration, *Platform, *Configuration));
+        return true;
+    }
+
+    double NsTolerance = DefaultNsTolerance;
+    Baseline->TryGetNumberField(TEXT("ns_tolerance"), NsTolerance);
+    double AllocsTolerance = DefaultAllocsTolerance;
+    Baseline->TryGetNumberField(TEXT("allocs_tolerance"), AllocsTolerance);
+
+    if (!TestTrue(TEXT("Allocations should be countable, run with -OGAsyncCountAllocations"), OGAsyncBenchmarks::CanCountAllocations()))
+        return false;
+
+    TMap<FString, FBaselineEntry> Entries;
+    for (const TSharedPtr<FJsonValue>& Value : Baseline->GetArrayField(TEXT("benchmarks")))
+    {
+        const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+        FBaselineEntry& Entry = Entries.Add(Object->GetStringField(TEXT("name")));
+        Entry.NsPerOp = Object->GetNumberField(TEXT("ns_per_op"));
+        Entry.AllocsPerOp = Object->GetNumberField(TEXT("allocs_per_op"));
+        Entry.NsTolerance = NsTolerance;
+        Entry.AllocsTolerance = AllocsTolerance;
+        Object->TryGetNumberField(TEXT("ns_tolerance"), Entry.NsTolerance);
+        Object->TryGetNumberField(TEXT("allocs_tolerance"), Entry.AllocsTolerance);
+    }
+    TestTrue(TEXT("Baseline should list benchmarks"), Entries.Num() > 0);
+
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    TMap<FString, FOGBenchmarkResult> Best;
+    for (int32 RunIndex = 0; RunIndex < NumRuns; ++RunIndex)
+    {
+        for (const FOGBenchmarkResult& Result : OGAsyncBenchmarks::Run(ContextObject, [&Entries](const FString& Name) { return Entries.Contains(Name); }, MinSecondsPerRun))
+        {
+            FOGBenchmarkResult* Existing = Best.Find(Result.Name);
+            if (!Existing)
+            {
+                Best.Add(Result.Name, Result);
+                continue;
+            }
+            Existing->NsPerOp = FMath::Min(Existing->NsPerOp, Result.NsPerOp);
+            Existing->AllocsPerOp = FMath::Min(Existing->AllocsPerOp, Result.AllocsPerOp);
+        }
+    }
+
+    bool bRegressed = false;
+    for (const TPair<FString, FBaselineEntry>& Entry : Entries)
+    {
+        const FOGBenchmarkResult* Result = Best.Find(Entry.Key);
+        if (!TestNotNull(FString::Printf(TEXT("Baseline benchmark %s should exist"), *Entry.Key), Result))
+            continue;
+
+        const FBaselineEntry& Expected = Entry.Value;
+        const double MaxNs = Expected.NsPerOp * (1.0 + Expected.NsTolerance);
+        const double MaxAllocs = Expected.AllocsPerOp * (1.0 + Expected.AllocsTolerance) + AllocsSlack;
+        AddInfo(FString::Printf(TEXT("%s: %.1f ns/op (baseline %.1f), %.2f allocs/op (baseline %.2f)"),
+            *Entry.Key, Result->NsPerOp, Expected.NsPerOp, Result->AllocsPerOp, Expected.AllocsPerOp));
+
+        TArray<FString> Regressions;
+        if (Result->NsPerOp > MaxNs)
+        {
+            Regressions.Add(FString::Printf(TEXT("%s took %.1f ns/op, over the %.1f allowed"), *Entry.Key, Result->NsPerOp, MaxNs));
+        }
+        if (Result->AllocsPerOp > MaxAllocs)
+        {
+            Regressions.Add(FString::Printf(TEXT("%s made %.2f allocs/op, over the %.2f allowed"), *Entry.Key, Result->AllocsPerOp, MaxAllocs));
+        }
+        for (const FString& Regression : Regressions)
+        {
+            bRegressed = true;
+            AddError(Regression);
+        }
+    }
+
+    if (bRegressed)
+    {
+        TArray<FOGBenchmarkResult> Results;
+        Best.GenerateValueArray(Results);
+        const FString OutputPath = FPaths::ProfilingDir() / TEXT("OGAsyncPerf.json");
+        FFileHelper::SaveStringToFile(OGAsyncBenchmarks::ToJson(Results), *OutputPath);
+        AddInfo(FString::Printf(TEXT("Wrote this run's results to %s"), *OutputPath));
+    }
+
+    return true;
+}
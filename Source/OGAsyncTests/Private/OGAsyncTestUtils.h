@@ -0,0 +1,28 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OGAsyncDispatch.h"
+#include "OGFuture.h"
+
+namespace OGAsyncTests
+{
+    // Work finished on other threads is marshalled back through the game thread queue, so keep draining it until the condition holds
+    inline bool WaitUntil(TFunctionRef<bool()> Condition, double TimeoutSeconds = 10.0)
+    {
+        const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+        while (!Condition() && FPlatformTime::Seconds() < EndTime)
+        {
+            OGAsync::FlushGameThreadQueue();
+            FPlatformProcess::Sleep(0.f);
+        }
+        OGAsync::FlushGameThreadQueue();
+        return Condition();
+    }
+
+    inline bool WaitForFuture(const FOGFuture& Future, double TimeoutSeconds = 10.0)
+    {
+        return WaitUntil([&Future]() { return !Future->IsPending(); }, TimeoutSeconds);
+    }
+}
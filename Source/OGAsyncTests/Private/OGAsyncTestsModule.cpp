@@ -1,5 +1,5 @@
-﻿/// Copyright Occam's Gamekit contributors 2025
-
-#include "OGAsyncTestsModule.h"
-	
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "OGAsyncTestsModule.h"
+	
 IMPLEMENT_MODULE(FOGAsyncTestsModule, OGAsyncTests)
\ No newline at end of file
@@ -0,0 +1,602 @@
+﻿/// Copyright Occam's Gamekit contributors 2025
+
+#include "CoreMinimal.h"
+#include "Algo/IsSorted.h"
+#include "Misc/AutomationTest.h"
+#include "OGActor.h"
+#include "OGAsyncDispatch.h"
+#include "OGAsyncParallel.h"
+#include "OGAsyncRender.h"
+#include "OGAsyncTestUtils.h"
+#include "OGFutureInterop.h"
+#include "OGMemoize.h"
+#include "OGStrand.h"
+#include "Tests/AutomationCommon.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncRenderCommandTest, "OccamsGamekit.OGAsync.Threading.RenderCommand",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncRenderCommandTest::RunTest(const FString& Parameters)
+{
+    // Test 1: Value is marshalled back to the game thread
+    {
+        bool RanOnRenderThread = false;
+        TOGFuture<int> Future = OGAsync::EnqueueRenderCommandAsync([&RanOnRenderThread](FRHICommandListImmediate& RHICmdList)
+        {
+            RanOnRenderThread = IsInRenderingThread();
+            return 7;
+        });
+
+        FlushRenderingCommands();
+        TestTrue(TEXT("Render command should have run on the rendering thread"), RanOnRenderThread);
+        TestTrue(TEXT("Future should not resolve until the game thread batch runs"), Future->IsPending());
+
+        OGAsync::FlushGameThreadQueue();
+        TestTrue(TEXT("Future should be fulfilled after the game thread batch"), Future->IsFulfilled());
+        TestEqual(TEXT("Future should hold the render thread result"), Future->GetValueSafe(), 7);
+    }
+
+    // Test 2: Void commands
+    {
+        TOGFuture<void> Future = OGAsync::EnqueueRenderCommandAsync([](FRHICommandListImmediate& RHICmdList) {});
+
+        FlushRenderingCommands();
+        OGAsync::FlushGameThreadQueue();
+        TestTrue(TEXT("Void render command future should be fulfilled"), Future->IsFulfilled());
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncParallelForTest, "OccamsGamekit.OGAsync.Threading.ParallelFor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncParallelForTest::RunTest(const FString& Parameters)
+{
+    // Test 1: Every index is visited exactly once
+    {
+        constexpr int32 Num = 100000;
+        TArray<std::atomic<int32>> Visits;
+        Visits.SetNum(Num);
+
+        TOGFuture<void> Future = OGAsync::ParallelForAsync(Num, [&Visits](int32 Index)
+        {
+            Visits[Index].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        TestTrue(TEXT("ParallelForAsync should resolve"), OGAsyncTests::WaitForFuture(Future));
+        int32 NumWrong = 0;
+        for (const std::atomic<int32>& Count : Visits)
+        {
+            NumWrong += Count.load() != 1;
+        }
+        TestEqual(TEXT("Every index should be visited exactly once"), NumWrong, 0);
+    }
+
+    // Test 2: Uneven work still completes when workers steal from each other
+    {
+        constexpr int32 Num = 256;
+        std::atomic<int32> Total = 0;
+        FOGParallelOptions Options;
+        Options.MaxWorkers = 4;
+
+        TOGFuture<void> Future = OGAsync::ParallelForAsync(Num, [&Total](int32 Index)
+        {
+            if (Index < 8)
+            {
+                FPlatformProcess::Sleep(0.005f);
+            }
+            Total.fetch_add(Index, std::memory_order_relaxed);
+        }, Options);
+
+        TestTrue(TEXT("ParallelForAsync should resolve"), OGAsyncTests::WaitForFuture(Future));
+        TestEqual(TEXT("All indices should be summed"), Total.load(), Num * (Num - 1) / 2);
+    }
+
+    // Test 3: Empty range resolves immediately
+    {
+        TOGFuture<void> Future = OGAsync::ParallelForAsync(0, [](int32 Index) {});
+        TestTrue(TEXT("Empty ParallelForAsync should be fulfilled immediately"), Future->IsFulfilled());
+    }
+
+    // Test 4: MapReduce
+    {
+        TArray<int32> Inputs;
+        for (int32 Index = 1; Index <= 10000; ++Index)
+        {
+            Inputs.Add(Index);
+        }
+
+        TOGFuture<int64> Future = OGAsync::MapReduceAsync(MakeArrayView(Inputs),
+            [](const int32& Value) { return static_cast<int64>(Value) * 2; },
+            [](int64 A, int64 B) { return A + B; });
+
+        TestTrue(TEXT("MapReduceAsync should resolve"), OGAsyncTests::WaitForFuture(Future));
+        TestEqual(TEXT("MapReduceAsync should reduce every mapped value"), Future->GetValueSafe(), static_cast<int64>(10000) * 10001);
+    }
+
+    // Test 5: MapReduce with no inputs is rejected
+    {
+        TArray<int32> Inputs;
+        TOGFuture<int32> Future = OGAsync::MapReduceAsync(MakeArrayView(Inputs),
+            [](const int32& Value) { return Value; },
+            [](int32 A, int32 B) { return A + B; });
+        TestTrue(TEXT("MapReduceAsync with no inputs should be rejected"), Future->IsRejected());
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncThenParallelTest, "OccamsGamekit.OGAsync.Threading.ThenParallel",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncThenParallelTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    TArray<int32> Inputs;
+    for (int32 Index = 0; Index < 50000; ++Index)
+    {
+        Inputs.Add(Index);
+    }
+
+    // Test 1: Map each element into a new array, preserving order
+    {
+        TOGPromise<TArray<int32>> Promise;
+        TOGFuture<TArray<FString>> Mapped = Promise->ThenMapParallel(ContextObject, [](const int32& Value)
+        {
+            return FString::FromInt(Value * 2);
+        });
+
+        Promise->Fulfill(Inputs);
+        TestTrue(TEXT("ThenMapParallel should resolve"), OGAsyncTests::WaitForFuture(Mapped));
+
+        const TArray<FString>& Results = Mapped->GetValueSafe();
+        TestEqual(TEXT("Mapped array should have one result per element"), Results.Num(), Inputs.Num());
+        TestEqual(TEXT("Mapped results should stay in input order"), Results.Last(), FString::FromInt(Inputs.Last() * 2));
+    }
+
+    // Test 2: ForEach visits every element
+    {
+        TOGPromise<TArray<int32>> Promise;
+        std::atomic<int64> Sum = 0;
+        TOGFuture<void> Done = Promise->ThenForEachParallel(ContextObject, [&Sum](const int32& Value)
+        {
+            Sum.fetch_add(Value, std::memory_order_relaxed);
+        });
+
+        Promise->Fulfill(Inputs);
+        TestTrue(TEXT("ThenForEachParallel should resolve"), OGAsyncTests::WaitForFuture(Done));
+        TestEqual(TEXT("Every element should be visited"), Sum.load(), static_cast<int64>(49999) * 50000 / 2);
+    }
+
+    // Test 3: Rejection propagates without running the body
+    {
+        TOGPromise<TArray<int32>> Promise;
+        bool BodyRan = false;
+        TOGFuture<TArray<int32>> Mapped = Promise->ThenMapParallel(ContextObject, [&BodyRan](const int32& Value)
+        {
+            BodyRan = true;
+            return Value;
+        });
+
+        Promise->Throw(TEXT("Load failed"));
+        TestTrue(TEXT("Mapped future should be rejected"), Mapped->IsRejected());
+        TestFalse(TEXT("Map should not run for a rejected future"), BodyRan);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncSortTest, "OccamsGamekit.OGAsync.Threading.Sort",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncSortTest::RunTest(const FString& Parameters)
+{
+    FRandomStream Random(1234);
+
+    // Test 1: Large inputs are sorted on workers
+    {
+        TArray<int32> Items;
+        for (int32 Index = 0; Index < 200000; ++Index)
+        {
+            Items.Add(Random.RandRange(0, 1000000));
+        }
+
+        TOGFuture<TArray<int32>> Sorted = OGAsync::SortAsync(MoveTemp(Items));
+        TestTrue(TEXT("Input array should be moved into the sort"), Items.IsEmpty());
+        TestTrue(TEXT("SortAsync should resolve"), OGAsyncTests::WaitForFuture(Sorted));
+
+        const TArray<int32>& Result = Sorted->GetValueSafe();
+        TestEqual(TEXT("Sorted array should keep every element"), Result.Num(), 200000);
+        TestTrue(TEXT("Sorted array should be in order"), Algo::IsSorted(Result));
+    }
+
+    // Test 2: Custom predicate
+    {
+        TArray<int32> Items;
+        for (int32 Index = 0; Index < 50000; ++Index)
+        {
+            Items.Add(Random.RandRange(0, 1000));
+        }
+
+        TOGFuture<TArray<int32>> Sorted = OGAsync::SortAsync(MoveTemp(Items), TGreater<int32>());
+        TestTrue(TEXT("SortAsync should resolve"), OGAsyncTests::WaitForFuture(Sorted));
+        TestTrue(TEXT("Array should be sorted with the predicate"), Algo::IsSorted(Sorted->GetValueSafe(), TGreater<int32>()));
+    }
+
+    // Test 3: Small inputs are sorted inline
+    {
+        TArray<int32> Items = {5, 3, 9, 1};
+        TOGFuture<TArray<int32>> Sorted = OGAsync::SortAsync(MoveTemp(Items));
+        TestTrue(TEXT("Small sorts should be fulfilled immediately"), Sorted->IsFulfilled());
+        TestEqual(TEXT("Small sort should be in order"), Sorted->GetValueSafe(), TArray<int32>({1, 3, 5, 9}));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncStrandTest, "OccamsGamekit.OGAsync.Threading.Strand",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncStrandTest::RunTest(const FString& Parameters)
+{
+    FTestWorldWrapper WorldWrapper;
+    WorldWrapper.CreateTestWorld(EWorldType::Game);
+    UWorld* World = WorldWrapper.GetTestWorld();
+    if (!World)
+        return false;
+
+    AActor* ContextObject = World->SpawnActor<AActor>();
+    ON_SCOPE_EXIT{ContextObject->Destroy();};
+
+    // Test 1: Work posted to a strand runs one at a time, in order, off the game thread
+    {
+        FOGStrand Strand;
+        TArray<int32> Order;
+        bool RanOnGameThread = false;
+        for (int32 Index = 0; Index < 1000; ++Index)
+        {
+            //Unsynchronised on purpose, the strand is the only thing keeping these appends safe
+            Strand.Post([&Order, &RanOnGameThread, Index]()
+            {
+                RanOnGameThread |= IsInGameThread();
+                Order.Add(Index);
+            });
+        }
+
+        TOGFuture<int32> Count = Strand.Run([&Order]() { return Order.Num(); });
+        TestTrue(TEXT("Run should resolve"), OGAsyncTests::WaitForFuture(Count));
+        TestEqual(TEXT("Run should see everything posted before it"), Count->GetValueSafe(), 1000);
+        TestFalse(TEXT("Strand work should run on workers"), RanOnGameThread);
+
+        bool InOrder = true;
+        for (int32 Index = 0; Index < Order.Num(); ++Index)
+        {
+            InOrder &= Order[Index] == Index;
+        }
+        TestTrue(TEXT("Strand work should run in the order it was posted"), InOrder);
+    }
+
+    // Test 2: ThenOn continuations are serialised with each other and their results come back to the game thread
+    {
+        FOGStrand Strand;
+        int32 Total = 0;
+        TArray<TOGPromise<int32>> Promises;
+        TArray<TOGFuture<int32>> Results;
+        for (int32 Index = 0; Index < 8; ++Index)
+        {
+            TOGPromise<int32>& Promise = Promises.AddDefaulted_GetRef();
+            Results.Add(Promise->ThenOn(Strand, ContextObject, [&Total](const int32& Value) { return Total += Value; }));
+        }
+        for (TOGPromise<int32>& Promise : Promises)
+        {
+            Promise->Fulfill(1);
+        }
+
+        TestTrue(TEXT("Last continuation should resolve"), OGAsyncTests::WaitForFuture(Results.Last()));
+        TestEqual(TEXT("Every continuation should have run exactly once"), Total, 8);
+        TestEqual(TEXT("Continuations should run in the order their futures resolved"), Results.Last()->GetValueSafe(), 8);
+    }
+
+    // Test 3: Rejections skip the strand
+    {
+        FOGStrand Strand;
+        bool Ran = false;
+        TOGPromise<void> Promise;
+        TOGFuture<void> Next = Promise->ThenOn(Strand, ContextObject, [&Ran]() { Ran = true; });
+        Promise->Throw(TEXT("Failed"));
+        TestTrue(TEXT("Rejection should propagate"), Next->IsRejected());
+        Strand.WaitUntilIdle();
+        TestFalse(TEXT("Continuation should not run"), Ran);
+    }
+
+    return true;
+}
+
+namespace OGAsyncActorTest
+{
+    struct FAdd { int32 Amount = 0; };
+    struct FGetTotal {};
+    struct FWaitFor { FEvent* Event = nullptr; };
+
+    struct FCounter
+    {
+        int32 Total = 0;
+        int32 NumMessages = 0;
+        bool HandledOnGameThread = false;
+
+        void Handle(const FAdd& Message)
+        {
+            HandledOnGameThread |= IsInGameThread();
+            Total += Message.Amount;
+            NumMessages++;
+        }
+
+        int32 Handle(const FGetTotal& Message)
+        {
+            NumMessages++;
+            return Total;
+        }
+
+        void Handle(const FWaitFor& Message)
+        {
+            Message.Event->Wait();
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncActorTest, "OccamsGamekit.OGAsync.Threading.Actor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncActorTest::RunTest(const FString& Parameters)
+{
+    using namespace OGAsyncActorTest;
+
+    // Test 1: Messages told from many workers are all handled, one at a time
+    {
+        TOGActor<FCounter> Counter;
+        TOGFuture<void> Sent = OGAsync::ParallelForAsync(10000, [&Counter](int32 Index)
+        {
+            Counter.Tell(FAdd{1});
+        });
+        TestTrue(TEXT("Workers should finish sending"), OGAsyncTests::WaitForFuture(Sent));
+
+        TOGFuture<int32> Total = Counter.Ask(FGetTotal());
+        TestTrue(TEXT("Ask should resolve"), OGAsyncTests::WaitForFuture(Total));
+        TestEqual(TEXT("Every message should be handled exactly once"), Total->GetValueSafe(), 10000);
+    }
+
+    // Test 2: Replies resolve in the order the messages were sent from one thread
+    {
+        TOGActor<FCounter> Counter;
+        Counter.SetMaxBatchSize(4);
+        TArray<TOGFuture<int32>> Totals;
+        for (int32 Index = 0; Index < 20; ++Index)
+        {
+            Counter.Tell(FAdd{1});
+            Totals.Add(Counter.Ask(FGetTotal()));
+        }
+
+        TestTrue(TEXT("Last reply should resolve"), OGAsyncTests::WaitForFuture(Totals.Last()));
+        bool InOrder = true;
+        for (int32 Index = 0; Index < Totals.Num(); ++Index)
+        {
+            InOrder &= Totals[Index]->IsFulfilled() && Totals[Index]->GetValueSafe() == Index + 1;
+        }
+        TestTrue(TEXT("Each reply should see every message sent before it, across batches"), InOrder);
+    }
+
+    // Test 3: Asks still queued when the actor is destroyed resolve instead of staying pending
+    {
+        FEvent* Release = FPlatformProcess::GetSynchEventFromPool();
+        ON_SCOPE_EXIT{FPlatformProcess::ReturnSynchEventToPool(Release);};
+
+        TUniquePtr<TOGActor<FCounter>> Counter = MakeUnique<TOGActor<FCounter>>();
+        Counter->Tell(FWaitFor{Release});
+        TArray<TOGFuture<int32>> Totals;
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            Totals.Add(Counter->Ask(FGetTotal()));
+        }
+
+        // Released while the destructor waits for the blocked activation, whatever was not handled by then is dropped
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [Release]()
+        {
+            FPlatformProcess::Sleep(0.1f);
+            Release->Trigger();
+        });
+        Counter.Reset();
+
+        for (const TOGFuture<int32>& Total : Totals)
+        {
+            TestTrue(TEXT("Every Ask should resolve after the actor is destroyed"), OGAsyncTests::WaitForFuture(Total));
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncMemoizeTest, "OccamsGamekit.OGAsync.Threading.Memoize",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncMemoizeTest::RunTest(const FString& Parameters)
+{
+    int32 NumCalls = 0;
+    TArray<TOGPromise<int32>> Promises;
+    auto Square = [&NumCalls, &Promises](const int32& Value)
+    {
+        NumCalls++;
+        TOGPromise<int32>& Promise = Promises.AddDefaulted_GetRef();
+        return TOGFuture<int32>(Promise);
+    };
+    auto HashKey = [](const int32& Value)
+    {
+        FSHA1 Hasher;
+        Hasher.Update(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+        return Hasher.Finalize();
+    };
+
+    // Test 1: Concurrent calls share one computation, and later calls are served from memory
+    {
+        auto Memoized = OGAsync::Memoize<int32>(Square, HashKey, FOGMemoCachePolicy{8, false});
+        TOGFuture<int32> First = Memoized(3);
+        TOGFuture<int32> Second = Memoized(3);
+        TestEqual(TEXT("Identical calls in flight should share one computation"), NumCalls, 1);
+
+        Promises.Last()->Fulfill(9);
+        TestTrue(TEXT("Both calls should resolve"), First->IsFulfilled() && Second->GetValueSafe() == 9);
+
+        TOGFuture<int32> Third = Memoized(3);
+        TestTrue(TEXT("Cached result should be returned immediately"), Third->IsFulfilled() && Third->GetValueSafe() == 9);
+        TestEqual(TEXT("Cached result should not call the function again"), NumCalls, 1);
+
+        Memoized(4);
+        Promises.Last()->Throw(TEXT("Failed"));
+        Memoized(4);
+        TestEqual(TEXT("Rejections should not be cached"), NumCalls, 3);
+    }
+
+    // Test 2: Results survive on disk for a fresh memoized function with the same cache name
+    {
+        const FString CacheName = TEXT("OGAsyncTests.Memoize");
+        OGAsync::ClearMemoCache(CacheName);
+        ON_SCOPE_EXIT{OGAsync::ClearMemoCache(CacheName);};
+        NumCalls = 0;
+
+        TOGFuture<int32> Computed = OGAsync::Memoize<int32>(Square, HashKey, FOGMemoCachePolicy{8, true, CacheName})(5);
+        TestTrue(TEXT("Disk miss should fall through to the function"), OGAsyncTests::WaitUntil([&NumCalls]() { return NumCalls == 1; }));
+        Promises.Last()->Fulfill(25);
+        TestTrue(TEXT("Computed result should resolve"), Computed->IsFulfilled());
+
+        //The write happens on a background task, give it a moment to land
+        const FString Path = OGAsync::Private::GetMemoCachePath(CacheName, OGAsync::Memoize<int32>(Square, HashKey, FOGMemoCachePolicy{8, true, CacheName}).GetKey(5));
+        TestTrue(TEXT("Result should be written to disk"), OGAsyncTests::WaitUntil([&Path]() { return FPaths::FileExists(Path); }));
+
+        TOGFuture<int32> Loaded = OGAsync::Memoize<int32>(Square, HashKey, FOGMemoCachePolicy{8, true, CacheName})(5);
+        TestTrue(TEXT("Cached result should load from disk"), OGAsyncTests::WaitForFuture(Loaded));
+        TestEqual(TEXT("Loaded result should match"), Loaded->GetValueSafe(), 25);
+        TestEqual(TEXT("Function should not run again"), NumCalls, 1);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncWaitTest, "OccamsGamekit.OGAsync.Threading.Wait",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncWaitTest::RunTest(const FString& Parameters)
+{
+    // Test 1: A worker blocked in Get wakes up with the value once the game thread fulfills the future
+    {
+        TOGPromise<int32> Promise;
+        TOGFuture<int32> Future = Promise;
+        std::atomic<int32> Received = INDEX_NONE;
+        UE::Tasks::FTask Waiter = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Future, &Received]()
+        {
+            if (const int32* Value = Future->Get(FTimespan::FromSeconds(10.0)))
+            {
+                Received = *Value;
+            }
+        });
+
+        FPlatformProcess::Sleep(0.05f);
+        Promise->Fulfill(7);
+        TestTrue(TEXT("Waiting worker should finish"), Waiter.Wait(FTimespan::FromSeconds(10.0)));
+        TestEqual(TEXT("Worker should receive the value"), Received.load(), 7);
+    }
+
+    // Test 2: Wait times out on a future that never resolves, and reports rejections as resolved
+    {
+        TOGPromise<int32> Promise;
+        TOGFuture<int32> Future = Promise;
+        std::atomic<bool> TimedOut = false;
+        std::atomic<bool> GotValue = true;
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [Future, &TimedOut]()
+        {
+            TimedOut = !Future->Wait(FTimespan::FromMilliseconds(10.0));
+        }).Wait();
+        TestTrue(TEXT("Wait should give up after the timeout"), TimedOut.load());
+
+        Promise->Throw(TEXT("Failed"));
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [Future, &GotValue]()
+        {
+            GotValue = Future->Get() != nullptr;
+        }).Wait();
+        TestFalse(TEXT("Get should return null for a rejected future"), GotValue.load());
+    }
+
+    // Test 3: Resolved futures return straight away, even on the game thread
+    {
+        TOGPromise<void> Promise;
+        Promise->Fulfill();
+        TestTrue(TEXT("Wait on a resolved future should not block"), Promise->Wait(FTimespan::Zero()));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOGAsyncInteropTest, "OccamsGamekit.OGAsync.Threading.Interop",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FOGAsyncInteropTest::RunTest(const FString& Parameters)
+{
+    // Test 1: An engine future from Async resolves the converted future on the game thread
+    {
+        TOGFuture<FString> Future = OGAsync::ToOGFuture(Async(EAsyncExecution::ThreadPool, []() { return FString(TEXT("Loaded")); }));
+        TestTrue(TEXT("Converted future should resolve"), OGAsyncTests::WaitForFuture(Future));
+        TestEqual(TEXT("Converted future should hold the value"), Future->GetValueSafe(), FString(TEXT("Loaded")));
+    }
+
+    // Test 2: A task result is moved into the converted future
+    {
+        UE::Tasks::TTask<TArray<int32>> Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, []() { return TArray<int32>{1, 2, 3}; });
+        TOGFuture<TArray<int32>> Future = OGAsync::ToOGFuture(Task);
+        TestTrue(TEXT("Converted task should resolve"), OGAsyncTests::WaitForFuture(Future));
+        TestEqual(TEXT("Converted task should hold the value"), Future->IsFulfilled() ? Future->GetValueSafe().Num() : 0, 3);
+        TestTrue(TEXT("Task result should have been moved out"), Task.GetResult().IsEmpty());
+
+        TOGFuture<void> VoidFuture = OGAsync::ToOGFuture(UE::Tasks::Launch(UE_SOURCE_LOCATION, []() {}));
+        TestTrue(TEXT("Converted void task should resolve"), OGAsyncTests::WaitForFuture(VoidFuture) && VoidFuture->IsFulfilled());
+    }
+
+    // Test 3: A task made from a future waits for it, and can be used as a prerequisite
+    {
+        TOGPromise<int32> Promise;
+        UE::Tasks::TTask<TOptional<int32>> Task = OGAsync::ToTask(TOGFuture<int32>(Promise));
+        std::atomic<int32> Doubled = 0;
+        UE::Tasks::FTask Dependent = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Task, &Doubled]() mutable
+        {
+            Doubled = Task.GetResult().Get(0) * 2;
+        }, UE::Tasks::Prerequisites(Task));
+
+        FPlatformProcess::Sleep(0.05f);
+        TestFalse(TEXT("Task should not complete before the future resolves"), Task.IsCompleted());
+        Promise->Fulfill(21);
+        TestTrue(TEXT("Dependent task should finish"), Dependent.Wait(FTimespan::FromSeconds(10.0)));
+        TestEqual(TEXT("Dependent task should see the value"), Doubled.load(), 42);
+    }
+
+    // Test 4: Rejected futures complete their task without a value
+    {
+        TOGPromise<int32> Promise;
+        UE::Tasks::TTask<TOptional<int32>> Task = OGAsync::ToTask(TOGFuture<int32>(Promise));
+        Promise->Throw(TEXT("Failed"));
+        TestTrue(TEXT("Task should complete on rejection"), Task.Wait(FTimespan::FromSeconds(10.0)));
+        TestFalse(TEXT("Task should hold no value"), Task.GetResult().IsSet());
+
+        TOGPromise<void> VoidPromise;
+        UE::Tasks::TTask<bool> VoidTask = OGAsync::ToTask(TOGFuture<void>(VoidPromise));
+        VoidPromise->Fulfill();
+        TestTrue(TEXT("Void task should report fulfillment"), VoidTask.Wait(FTimespan::FromSeconds(10.0)) && VoidTask.GetResult());
+    }
+
+    return true;
+}